@@ -27,6 +27,7 @@
 #include "Engine/Graphics/Image.h"
 #include "Engine/Graphics/TurnBasedOverlay.h"
 #include "Engine/Localization.h"
+#include "Engine/LocationPrefetch.h"
 #include "Engine/LodTextureCache.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/Chest.h"
@@ -34,6 +35,7 @@
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/NPC.h"
 #include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatCache.h"
 #include "Engine/Party.h"
 #include "Engine/SaveLoad.h"
 #include "Engine/Random/Random.h"
@@ -97,6 +99,9 @@ Game::Game(PlatformApplication *application, std::shared_ptr<GameConfig> config)
 Game::~Game() = default;
 
 int Game::run() {
+    MM_AT_SCOPE_EXIT(FinishPendingSave());
+    MM_AT_SCOPE_EXIT(CancelLocationPrefetch());
+
     window->activate();
     ::eventLoop->processMessages(eventHandler);
 
@@ -303,6 +308,7 @@ void Game::processQueuedMessages() {
 
     while (engine->_messageQueue->haveMessages()) {
         engine->_messageQueue->popMessage(&uMessage, &uMessageParam, &uMessageParam2);
+        CharacterStatCache::invalidateAll(); // Message handlers poke directly into character fields.
         switch (uMessage) {
             case UIMSG_ChangeGameState:
                 uGameState = GAME_FINISHED;
@@ -1613,6 +1619,11 @@ void Game::gameLoop() {
 
         bool game_finished = false;
         do {
+            // Autosaves are written in the background while the rest of the frame runs, e.g. while the next map is
+            // loading. Picking up the result at a fixed point in the frame keeps the game deterministic.
+            FinishPendingSave();
+            CharacterStatCache::invalidateAll();
+
             MessageLoopWithWait();
 
             engine->particle_engine->UpdateParticles();
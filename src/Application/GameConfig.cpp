@@ -22,7 +22,13 @@ MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(PlatformWindowMode, CASE_INSENSITIVE, {
     {WINDOW_MODE_FULLSCREEN_BORDERLESS, "3"}
 });
 
-GameConfig::GameConfig() = default;
+GameConfig::GameConfig() {
+    gameplay.FloorChecksEps.bind(this, &hot.floorChecksEps);
+    gameplay.MaxActiveAIActors.bind(this, &hot.maxActiveAIActors);
+    graphics.BloodSplats.bind(this, &hot.bloodSplats);
+    debug.NoActors.bind(this, &hot.noActors);
+}
+
 GameConfig::~GameConfig() = default;
 
 static constexpr std::initializer_list<const char *> defaultCommands = {
@@ -130,13 +130,24 @@ class GameConfig : public Config {
         Bool FullMonsterID = {this, "full_monster_id", false,
             "Full monster info on popup."};
 
+        Bool VerifyStatCache = {this, "verify_stat_cache", false,
+            "Recalculate cached character stats on each access and log an error if the cached value is out of date."};
+
         Bool OverrideBuiltInResources = {this, "override_built_in_resources", false,
             "Allow overriding built-in game resources (shaders and scripts) with files in game data folder."};
 
+        Int InitThreads = {this, "init_threads", 0, &ValidateInitThreads,
+            "Number of threads to load game data with on startup, including the main thread. Use 0 to pick "
+            "automatically based on the number of CPU cores."};
+
      private:
         static int ValidateFrameTime(int frameTime) {
             return std::max(frameTime, 1);
         }
+
+        static int ValidateInitThreads(int threads) {
+            return std::max(threads, 0);
+        }
     };
 
     Debug debug{this};
@@ -709,4 +720,20 @@ class GameConfig : public Config {
     };
 
     CheatCommands commands{this};
+
+    /**
+     * Plain copies of config values that are read in tight loops, e.g. per face in floor level checks or per actor
+     * in actor updates. These are kept in sync with the corresponding config entries through change listeners, so
+     * reading them doesn't go through `std::any_cast`.
+     *
+     * Note that these are read-only, use the config entries to change the values.
+     */
+    struct HotValues {
+        int floorChecksEps = 0;
+        int maxActiveAIActors = 0;
+        bool bloodSplats = false;
+        bool noActors = false;
+    };
+
+    HotValues hot;
 };
@@ -17,6 +17,7 @@ CMRC_DECLARE(openenroth);
 FileSystemStarter::FileSystemStarter() = default;
 
 FileSystemStarter::~FileSystemStarter() {
+    cfs = nullptr;
     ufs = nullptr;
     dfs = nullptr;
 }
@@ -47,3 +48,11 @@ void FileSystemStarter::initDataFs(std::string_view path, bool pathOverridesBuil
 
     dfs = _dataFs.get();
 }
+
+void FileSystemStarter::initCacheFs(std::string_view path) {
+    assert(cfs == nullptr);
+
+    _cacheFs = std::make_unique<DirectoryFileSystem>(path);
+
+    cfs = _cacheFs.get();
+}
@@ -12,6 +12,7 @@ class FileSystemStarter {
 
     void initUserFs(bool ramFs, std::string_view path);
     void initDataFs(std::string_view path, bool pathOverridesBuiltIn);
+    void initCacheFs(std::string_view path);
 
  private:
     std::unique_ptr<FileSystem> _userFs;
@@ -19,4 +20,5 @@ class FileSystemStarter {
     std::unique_ptr<FileSystem> _dataDirFs;
     std::unique_ptr<FileSystem> _dataDirLowercaseFs;
     std::unique_ptr<FileSystem> _dataFs;
+    std::unique_ptr<FileSystem> _cacheFs;
 };
@@ -90,6 +90,8 @@ void GameStarter::initialize() {
     // Patch config.
     if (_options.quickStart)
         _config->graphics.GenerateTiles.setValue(false);
+    if (_options.initThreads)
+        _config->debug.InitThreads.setValue(*_options.initThreads);
 
     // Finish logger init now that we have user fs and know the desired log level.
     _logStarter.initialize(ufs, _options.logLevel ? *_options.logLevel : _config->debug.LogLevel.value());
@@ -100,6 +102,9 @@ void GameStarter::initialize() {
     _fsStarter.initDataFs(_options.dataPath, _config->debug.OverrideBuiltInResources.value());
     logger->info("Using data path '{}'.", _options.dataPath); // Can't use dfs->displayPath("") b/c it'll show "embedded://"...
 
+    // Cache lives on disk even if user data doesn't, so that retrace runs can benefit from it.
+    _fsStarter.initCacheFs((std::filesystem::path(_options.userPath) / "cache").generic_string());
+
     // Migrate saves if needed. We don't migrate anything else.
     if (!_options.ramFsUserData && _options.dataPath != _options.userPath)
         migrateSaves();
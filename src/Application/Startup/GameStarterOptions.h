@@ -14,4 +14,5 @@ struct GameStarterOptions {
     bool headless = false; // Run in headless mode.
     bool tracingRng = false; // Use tracing random engine?
     bool quickStart = false; // Skip whatever slow initialization that we have, including additional asset generation.
+    std::optional<int> initThreads; // Override number of threads used to load game data on startup.
 };
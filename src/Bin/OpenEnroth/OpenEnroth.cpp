@@ -6,6 +6,7 @@
 #include <string>
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
 
 #include "Application/Startup/GameStarter.h"
 
@@ -19,6 +20,7 @@
 #include "Library/StackTrace/StackTraceOnCrash.h"
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Trace/EventTrace.h"
+#include "Library/Trace/EventTraceBinary.h"
 
 #include "Utility/Streams/FileOutputStream.h"
 #include "Utility/String/Format.h"
@@ -28,6 +30,12 @@
 #include "Utility/Types.h"
 
 #include "OpenEnrothOptions.h"
+#include "RetraceJobs.h"
+
+static std::string savePathForTrace(std::string_view tracePath) {
+    // Saves are stored next to the traces, both for JSON ('trace.json') & binary ('trace.oetb') traces.
+    return std::filesystem::path(tracePath).replace_extension(".mm7").generic_string();
+}
 
 static std::string normalizeText(std::string_view text) {
     // Normalize to UNIX line endings. Need this b/c git on Windows checks out CRLF line endings.
@@ -45,7 +53,7 @@ static void printLines(const std::vector<std::string_view> &lines, ssize_t line,
         fmt::println(stderr, "{:>5}: {}", i + 1, lines[i]);
 }
 
-static void printTraceDiff(std::string_view current, std::string_view canonical) {
+static size_t printTraceDiff(std::string_view current, std::string_view canonical) {
     assert(canonical != current);
 
     std::vector<std::string_view> canonicalLines = split(canonical, '\n');
@@ -57,51 +65,92 @@ static void printTraceDiff(std::string_view current, std::string_view canonical)
     printLines(canonicalLines, line, 2);
     fmt::println(stderr, "Current:");
     printLines(currentLines, line, 2);
+    return line;
 }
 
 int runRetrace(const OpenEnrothOptions &options) {
-    GameStarter starter(options);
-
-    int status = 0;
-
-    starter.runInstrumented([&status, options, application = starter.application()] (EngineController *game) {
-        EngineTraceSimplePlayer *player = application->component<EngineTraceSimplePlayer>();
-        EngineTraceRecorder *recorder = application->component<EngineTraceRecorder>();
-
-        for (const std::string &tracePath : options.retrace.traces) {
-            fmt::println(stderr, "Retracing '{}'...", tracePath);
-            auto startTime = std::chrono::steady_clock::now();
-
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
-            Blob oldTraceBlob = Blob::fromFile(tracePath);
-            Blob oldSaveBlob = Blob::fromFile(savePath);
-
-            EventTrace oldTrace = EventTrace::fromJsonBlob(oldTraceBlob, application->window());
-
-            EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
-            recorder->startRecording(game, oldSaveBlob);
-            engine->config->graphics.FPSLimit.setValue(0);
-            player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
-            EngineTraceRecording recording = recorder->finishRecording(game);
-
-            auto endTime = std::chrono::steady_clock::now();
-            fmt::println(stderr, "Retraced in {}ms.", std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count());
-
-            if (!options.retrace.checkCanonical) {
-                oldTraceBlob = Blob(); // Close old trace file
-                FileOutputStream(tracePath).write(recording.trace);
-            } else {
-                std::string oldTraceJson = normalizeText(oldTraceBlob.string_view());
-                std::string newTraceJson = normalizeText(recording.trace.string_view());
-                if (oldTraceJson != newTraceJson) {
-                    fmt::println(stderr, "Trace '{}' is not in canonical representation.", tracePath);
-                    printTraceDiff(oldTraceJson, newTraceJson);
-                    status = 1;
+    const std::vector<std::string> &traces = options.retrace.traces;
+
+    std::vector<RetraceResult> results = runRetraceJobs(options.retrace.jobs, traces.size(), [&options, &traces] (const RetraceTaskSource &nextTask, const RetraceResultSink &reportResult) {
+        // With several jobs each one is a separate process, so a full thread pool in each would oversubscribe the CPU.
+        GameStarterOptions starterOptions = options;
+        if (options.retrace.jobs > 1)
+            starterOptions.initThreads = 1;
+        GameStarter starter(starterOptions);
+
+        starter.runInstrumented([&] (EngineController *game) {
+            PlatformApplication *application = starter.application();
+            EngineTraceSimplePlayer *player = application->component<EngineTraceSimplePlayer>();
+            EngineTraceRecorder *recorder = application->component<EngineTraceRecorder>();
+            engine->drawInterval = options.retrace.drawInterval;
+
+            while (std::optional<size_t> index = nextTask()) {
+                const std::string &tracePath = traces[*index];
+                fmt::println(stderr, "Retracing '{}'...", tracePath);
+                auto startTime = std::chrono::steady_clock::now();
+
+                std::string savePath = savePathForTrace(tracePath);
+                Blob oldTraceBlob = Blob::fromFile(tracePath);
+                Blob oldSaveBlob = Blob::fromFile(savePath);
+
+                // Binary traces are written back in binary, and are compared in JSON representation.
+                std::optional<bool> compressOldTrace;
+                if (EventTraceReader::isBinaryTrace(oldTraceBlob))
+                    compressOldTrace = EventTraceReader(oldTraceBlob, nullptr).isCompressed();
+
+                EventTrace oldTrace = EventTrace::fromBlob(oldTraceBlob, application->window());
+                if (compressOldTrace)
+                    oldTraceBlob = EventTrace::toJsonBlob(oldTrace);
+
+                EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
+                recorder->startRecording(game, oldSaveBlob);
+                engine->config->graphics.FPSLimit.setValue(0);
+                player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
+                EngineTraceRecording recording = recorder->finishRecording(game);
+
+                auto endTime = std::chrono::steady_clock::now();
+                int64_t durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+                fmt::println(stderr, "Retraced in {}ms.", durationMs);
+
+                RetraceResult result = {.success = true, .durationMs = durationMs};
+                if (!options.retrace.checkCanonical) {
+                    oldTraceBlob = Blob(); // Close old trace file
+                    if (compressOldTrace) {
+                        EventTrace newTrace = EventTrace::fromJsonBlob(recording.trace, application->window());
+                        FileOutputStream(tracePath).write(EventTrace::toBinaryBlob(newTrace, *compressOldTrace));
+                    } else {
+                        FileOutputStream(tracePath).write(recording.trace);
+                    }
+                } else {
+                    std::string oldTraceJson = normalizeText(oldTraceBlob.string_view());
+                    std::string newTraceJson = normalizeText(recording.trace.string_view());
+                    if (oldTraceJson != newTraceJson) {
+                        fmt::println(stderr, "Trace '{}' is not in canonical representation.", tracePath);
+                        size_t line = printTraceDiff(oldTraceJson, newTraceJson);
+                        result.success = false;
+                        result.failure = fmt::format("Trace is not in canonical representation, first difference is "
+                                                     "at line {}.", line);
+                    }
                 }
+
+                reportResult(*index, result);
             }
-        }
+        });
     });
 
+    if (!options.retrace.junitPath.empty())
+        writeRetraceJUnitReport(options.retrace.junitPath, traces, results);
+    if (!options.retrace.jsonPath.empty())
+        writeRetraceJsonReport(options.retrace.jsonPath, traces, results);
+
+    int status = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        if (!results[i].finished)
+            fmt::println(stderr, "Failed to retrace '{}'.", traces[i]);
+        if (!results[i].success)
+            status = 1;
+    }
+
     if (options.retrace.checkCanonical && status == 0)
         fmt::println(stderr, "All traces are in canonical representation.");
 
@@ -113,11 +162,12 @@ int runPlay(const OpenEnrothOptions &options) {
 
     starter.runInstrumented([options, application = starter.application()] (EngineController *game) {
         EngineTracePlayer *player = application->component<EngineTracePlayer>();
+        engine->drawInterval = options.play.drawInterval;
 
         for (const std::string &tracePath : options.play.traces) {
             fmt::println(stderr, "Playing back '{}'...", tracePath);
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+            std::string savePath = savePathForTrace(tracePath);
 
             EngineTraceRecording recording;
             recording.save = Blob::fromFile(savePath);
@@ -133,6 +183,20 @@ int runPlay(const OpenEnrothOptions &options) {
     return 0;
 }
 
+int runConvertTrace(const OpenEnrothOptions &options) {
+    // No need to start the engine here, conversion is lossless & doesn't need to know anything about the game.
+    EventTrace trace = EventTrace::fromBlob(Blob::fromFile(options.convertTrace.input), nullptr);
+
+    Blob result;
+    if (options.convertTrace.binary) {
+        result = EventTrace::toBinaryBlob(trace, options.convertTrace.compress);
+    } else {
+        result = EventTrace::toJsonBlob(trace);
+    }
+    FileOutputStream(options.convertTrace.output).write(result);
+    return 0;
+}
+
 int runOpenEnroth(const OpenEnrothOptions &options) {
     GameStarter(options).run();
     return 0;
@@ -151,6 +215,7 @@ int openEnrothMain(int argc, char **argv) {
         case OpenEnrothOptions::SUBCOMMAND_GAME: return runOpenEnroth(options);
         case OpenEnrothOptions::SUBCOMMAND_PLAY: return runPlay(options);
         case OpenEnrothOptions::SUBCOMMAND_RETRACE: return runRetrace(options);
+        case OpenEnrothOptions::SUBCOMMAND_CONVERT_TRACE: return runConvertTrace(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
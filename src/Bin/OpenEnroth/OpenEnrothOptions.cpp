@@ -10,6 +10,7 @@
 
 #include "Library/Cli/CliApp.h"
 #include "Library/Environment/Interface/Environment.h"
+#include "Library/Trace/EventTraceBinary.h"
 
 #include "Utility/Exception.h"
 #include "Utility/String/Format.h"
@@ -52,6 +53,10 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     play->add_option(
         "--speed", result.play.speed,
         "Playback speed, default is '1.0'.")->option_text("SPEED");
+    play->add_option(
+        "--draw-interval", result.play.drawInterval,
+        "Draw only every N-th frame and just run the game logic for the rest, '0' means never draw. Default is '1'. "
+        "Note that skipping draws might change how traces that rely on what's on screen play out.")->check(CLI::NonNegativeNumber)->option_text("N");
     play->add_option(
         "TRACE", result.play.traces,
         "Path to trace file(s) to play.")->required()->option_text("...");
@@ -65,6 +70,21 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     retrace->add_flag(
         "--check-canonical", result.retrace.checkCanonical,
         "Check whether all passed traces are stored in canonical representation and return an error if not. Don't overwrite the actual trace files.");
+    retrace->add_option(
+        "--draw-interval", result.retrace.drawInterval,
+        "Draw only every N-th frame and just run the game logic for the rest, '0' means never draw. Default is '1'. "
+        "Skipping draws might change how traces that rely on what's on screen play out, so with values other than '1' "
+        "trace files are never overwritten, and this option implies '--check-canonical'.")->check(CLI::NonNegativeNumber)->option_text("N");
+    retrace->add_option(
+        "-j,--jobs", result.retrace.jobs,
+        "Number of worker processes to retrace in. Each worker initializes the engine once and then retraces traces "
+        "one by one. Default is '1', which means retracing in the current process.")->check(CLI::PositiveNumber)->option_text("N");
+    retrace->add_option(
+        "--junit", result.retrace.junitPath,
+        "Write JUnit XML report to the provided file.")->option_text("PATH");
+    retrace->add_option(
+        "--json", result.retrace.jsonPath,
+        "Write JSON report to the provided file.")->option_text("PATH");
     retrace->add_option(
         "--ls", traceDir,
         "Directory to look for traces to retrace."); // This is here so that we don't have to jump through hoops in cmake.
@@ -73,6 +93,22 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
         "Path to trace file(s) to retrace.")->option_text("...");
     retrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
 
+    CLI::App *convertTrace = app->add_subcommand("convert-trace", "Convert a trace between JSON and binary formats and exit.", result.subcommand, SUBCOMMAND_CONVERT_TRACE)->fallthrough();
+    convertTrace->add_flag(
+        "--binary", result.convertTrace.binary,
+        "Write the trace in compact binary format. By default the trace is written as JSON.");
+    convertTrace->add_flag(
+        "--compress", result.convertTrace.compress,
+        "Compress the binary trace with zlib. Implies '--binary'.");
+    convertTrace->add_option(
+        "INPUT", result.convertTrace.input,
+        "Path to input trace file, either JSON or binary.")->required()->check(CLI::ExistingFile)->option_text("PATH");
+    convertTrace->add_option(
+        "OUTPUT", result.convertTrace.output,
+        fmt::format("Path to output trace file. Binary traces should use the '{}' extension, so that retrace can pick "
+                    "them up.", trace_binary::FILE_EXTENSION))->required()->option_text("PATH");
+    convertTrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
+
     app->parse(argc, argv, result.helpPrinted);
 
     if (!portable && std::filesystem::exists(".portable"))
@@ -90,7 +126,7 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
 
         if (!traceDir.empty()) {
             for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir))
-                if (entry.path().extension() == ".json")
+                if (entry.path().extension() == ".json" || entry.path().extension() == trace_binary::FILE_EXTENSION)
                     result.retrace.traces.push_back(entry.path().generic_string());
             std::ranges::sort(result.retrace.traces); // NOLINT: This is ranges::sort. We want a fixed order.
         }
@@ -98,10 +134,16 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
         if (result.retrace.traces.empty())
             throw Exception("No trace files to retrace.");
 
+        if (result.retrace.drawInterval != 1)
+            result.retrace.checkCanonical = true; // Traces recorded without drawing are not canonical.
+
         if (!result.logLevel)
             result.logLevel = LOG_ERROR; // Default log level for retracing is LOG_ERROR.
     }
 
+    if (result.subcommand == SUBCOMMAND_CONVERT_TRACE && result.convertTrace.compress)
+        result.convertTrace.binary = true;
+
     if (result.subcommand == SUBCOMMAND_PLAY) {
         result.ramFsUserData = true; // No config & no user data if playing a trace.
         result.quickStart = true;
@@ -12,24 +12,38 @@ struct OpenEnrothOptions : public GameStarterOptions {
     enum class Subcommand {
         SUBCOMMAND_GAME,
         SUBCOMMAND_PLAY,
-        SUBCOMMAND_RETRACE
+        SUBCOMMAND_RETRACE,
+        SUBCOMMAND_CONVERT_TRACE
     };
     using enum Subcommand;
 
     struct RetraceOptions {
         std::vector<std::string> traces;
         bool checkCanonical = false;
+        int drawInterval = 1;
+        int jobs = 1;
+        std::string junitPath;
+        std::string jsonPath;
     };
 
     struct PlayOptions {
         std::vector<std::string> traces;
         float speed = 1.0f;
+        int drawInterval = 1;
+    };
+
+    struct ConvertTraceOptions {
+        std::string input;
+        std::string output;
+        bool binary = false;
+        bool compress = false;
     };
 
     Subcommand subcommand = SUBCOMMAND_GAME;
     bool helpPrinted = false; // True means that help message was already printed.
     RetraceOptions retrace;
     PlayOptions play;
+    ConvertTraceOptions convertTrace;
 
     /**
      * Parses OpenEnroth command line options.
@@ -0,0 +1,290 @@
+#include "RetraceJobs.h"
+
+#ifndef _WINDOWS
+#   include <poll.h>
+#   include <csignal>
+#   include <unistd.h>
+#   include <sys/wait.h>
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cerrno>
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "Library/Json/Json.h"
+
+#include "Utility/Exception.h"
+#include "Utility/Streams/FileOutputStream.h"
+#include "Utility/String/Format.h"
+
+static std::vector<RetraceResult> runRetraceJobsInProcess(size_t taskCount, const RetraceWorker &worker) {
+    std::vector<RetraceResult> results(taskCount);
+    size_t nextTask = 0;
+
+    worker([&] () -> std::optional<size_t> {
+        if (nextTask == taskCount)
+            return std::nullopt;
+        return nextTask++;
+    }, [&] (size_t index, const RetraceResult &result) {
+        results[index] = result;
+        results[index].finished = true;
+    });
+
+    return results;
+}
+
+#ifndef _WINDOWS
+
+namespace {
+
+// Messages that are sent through the pipes. Both are smaller than PIPE_BUF, so reads & writes are atomic.
+struct TaskMessage {
+    int64_t index = -1; // -1 means there are no more tasks.
+};
+
+struct ResultMessage {
+    int64_t index = 0;
+    int64_t durationMs = 0;
+    int32_t success = 0;
+    char failure[256] = {}; // Null-terminated, truncated if it doesn't fit.
+};
+
+static_assert(sizeof(ResultMessage) <= 512); // POSIX guarantees PIPE_BUF >= 512.
+
+struct WorkerProcess {
+    pid_t pid = -1;
+    int taskFd = -1; // Parent -> worker.
+    int resultFd = -1; // Worker -> parent.
+    std::optional<size_t> task;
+};
+
+template<class T>
+bool readMessage(int fd, T *message) {
+    ssize_t size;
+    do {
+        size = read(fd, message, sizeof(T));
+    } while (size < 0 && errno == EINTR);
+    return size == sizeof(T);
+}
+
+template<class T>
+void writeMessage(int fd, const T &message) {
+    ssize_t size;
+    do {
+        size = write(fd, &message, sizeof(T));
+    } while (size < 0 && errno == EINTR);
+}
+
+[[noreturn]] void runWorkerProcess(int taskFd, int resultFd, const RetraceWorker &worker) {
+    int status = 0;
+    try {
+        worker([&] () -> std::optional<size_t> {
+            TaskMessage message;
+            if (!readMessage(taskFd, &message) || message.index < 0)
+                return std::nullopt;
+            return message.index;
+        }, [&] (size_t index, const RetraceResult &result) {
+            ResultMessage message{static_cast<int64_t>(index), result.durationMs, result.success};
+            size_t failureSize = std::min(result.failure.size(), sizeof(message.failure) - 1);
+            std::memcpy(message.failure, result.failure.data(), failureSize);
+            writeMessage(resultFd, message);
+        });
+    } catch (const std::exception &e) {
+        fmt::print(stderr, "{}\n", e.what());
+        status = 1;
+    }
+
+    std::fflush(stdout);
+    std::fflush(stderr);
+    _exit(status); // Don't run atexit handlers & static destructors that belong to the parent process.
+}
+
+} // namespace
+
+std::vector<RetraceResult> runRetraceJobs(int jobs, size_t taskCount, const RetraceWorker &worker) {
+    if (jobs < 2 || taskCount < 2)
+        return runRetraceJobsInProcess(taskCount, worker);
+    jobs = std::min<size_t>(jobs, taskCount);
+
+    // Writing into a pipe of a crashed worker shouldn't kill us.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    std::vector<RetraceResult> results(taskCount);
+    std::vector<WorkerProcess> workers;
+    size_t nextTask = 0;
+
+    // Flush so that buffered output doesn't get duplicated in the child processes.
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+    for (int i = 0; i < jobs; i++) {
+        int taskPipe[2];
+        int resultPipe[2];
+        if (pipe(taskPipe) != 0)
+            Exception::throwFromErrno("pipe");
+        if (pipe(resultPipe) != 0)
+            Exception::throwFromErrno("pipe");
+
+        pid_t pid = fork();
+        if (pid < 0)
+            Exception::throwFromErrno("fork");
+
+        if (pid == 0) {
+            // Close the parent's ends of the pipes, including the ones for the previously forked workers, so that
+            // workers get EOF if the parent dies.
+            for (const WorkerProcess &other : workers) {
+                close(other.taskFd);
+                close(other.resultFd);
+            }
+            close(taskPipe[1]);
+            close(resultPipe[0]);
+            runWorkerProcess(taskPipe[0], resultPipe[1], worker);
+        }
+
+        close(taskPipe[0]);
+        close(resultPipe[1]);
+        workers.push_back({pid, taskPipe[1], resultPipe[0], std::nullopt});
+    }
+
+    auto assignTask = [&] (WorkerProcess &process) {
+        if (nextTask < taskCount) {
+            process.task = nextTask++;
+            writeMessage(process.taskFd, TaskMessage{static_cast<int64_t>(*process.task)});
+        } else {
+            process.task.reset();
+            writeMessage(process.taskFd, TaskMessage{-1});
+        }
+    };
+
+    for (WorkerProcess &process : workers)
+        assignTask(process);
+
+    size_t aliveCount = workers.size();
+    std::vector<pollfd> fds;
+    while (aliveCount > 0) {
+        fds.clear();
+        for (const WorkerProcess &process : workers)
+            fds.push_back({process.resultFd, POLLIN, 0});
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            Exception::throwFromErrno("poll");
+        }
+
+        for (size_t i = 0; i < workers.size(); i++) {
+            WorkerProcess &process = workers[i];
+            if (process.resultFd < 0 || fds[i].revents == 0)
+                continue;
+
+            ResultMessage message;
+            if (readMessage(process.resultFd, &message)) {
+                assert(process.task && *process.task == message.index);
+                RetraceResult &result = results[message.index];
+                result.finished = true;
+                result.success = message.success;
+                result.durationMs = message.durationMs;
+                result.failure = message.failure;
+                assignTask(process);
+            } else {
+                // Worker has exited. If it was in the middle of a task, then it has crashed, and the task stays
+                // unfinished.
+                if (process.task)
+                    results[*process.task].failure = "Retrace worker process has crashed.";
+                close(process.resultFd);
+                close(process.taskFd);
+                process.resultFd = -1;
+                process.taskFd = -1;
+                aliveCount--;
+            }
+        }
+
+        // Reap dead workers & remove them from the poll set.
+        for (const WorkerProcess &process : workers)
+            if (process.resultFd < 0)
+                waitpid(process.pid, nullptr, 0);
+        std::erase_if(workers, [] (const WorkerProcess &process) { return process.resultFd < 0; });
+    }
+
+    return results;
+}
+
+#else // _WINDOWS
+
+std::vector<RetraceResult> runRetraceJobs(int jobs, size_t taskCount, const RetraceWorker &worker) {
+    // There is no fork on Windows, so parallel retrace would need to spawn worker processes & pass the traces to them
+    // instead. Until that's done, everything runs in the current process.
+    if (jobs > 1)
+        fmt::print(stderr, "Parallel retrace is not supported on Windows, ignoring '-j {}'.\n", jobs);
+    return runRetraceJobsInProcess(taskCount, worker);
+}
+
+#endif // _WINDOWS
+
+static std::string escapeXml(std::string_view text) {
+    std::string result;
+    for (char c : text) {
+        switch (c) {
+        case '&': result += "&amp;"; break;
+        case '<': result += "&lt;"; break;
+        case '>': result += "&gt;"; break;
+        case '"': result += "&quot;"; break;
+        case '\'': result += "&apos;"; break;
+        default: result += c; break;
+        }
+    }
+    return result;
+}
+
+void writeRetraceJUnitReport(const std::string &path, const std::vector<std::string> &traces,
+                             const std::vector<RetraceResult> &results) {
+    assert(traces.size() == results.size());
+
+    int64_t totalMs = 0;
+    size_t failures = 0;
+    for (const RetraceResult &result : results) {
+        totalMs += result.durationMs;
+        failures += !result.success;
+    }
+
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    xml += fmt::format("<testsuite name=\"retrace\" tests=\"{}\" failures=\"{}\" time=\"{:.3f}\">\n",
+                       results.size(), failures, totalMs / 1000.0);
+    for (size_t i = 0; i < results.size(); i++) {
+        const RetraceResult &result = results[i];
+        xml += fmt::format("  <testcase classname=\"retrace\" name=\"{}\" time=\"{:.3f}\"",
+                           escapeXml(traces[i]), result.durationMs / 1000.0);
+        if (result.success) {
+            xml += "/>\n";
+        } else {
+            xml += fmt::format("><failure message=\"{}\"/></testcase>\n",
+                               escapeXml(result.failure.empty() ? "Retrace failed." : result.failure));
+        }
+    }
+    xml += "</testsuite>\n";
+
+    FileOutputStream(path).write(xml);
+}
+
+void writeRetraceJsonReport(const std::string &path, const std::vector<std::string> &traces,
+                            const std::vector<RetraceResult> &results) {
+    assert(traces.size() == results.size());
+
+    Json json = Json::array();
+    for (size_t i = 0; i < results.size(); i++) {
+        json.push_back({
+            {"trace", traces[i]},
+            {"finished", results[i].finished},
+            {"success", results[i].success},
+            {"failure", results[i].failure},
+            {"durationMs", results[i].durationMs}
+        });
+    }
+
+    FileOutputStream(path).write(json.dump(4));
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct RetraceResult {
+    bool finished = false; // False if the worker that was retracing this trace has crashed.
+    bool success = false;
+    int64_t durationMs = 0;
+    std::string failure; // Failure reason if `success` is false, goes into the reports.
+};
+
+using RetraceTaskSource = std::function<std::optional<size_t>()>;
+using RetraceResultSink = std::function<void(size_t, const RetraceResult &)>;
+using RetraceWorker = std::function<void(const RetraceTaskSource &, const RetraceResultSink &)>;
+
+/**
+ * Runs retrace jobs in parallel.
+ *
+ * Each of the `jobs` worker processes is forked from the current process and runs `worker` exactly once. The worker is
+ * expected to initialize the engine, and then keep pulling trace indices from the provided task source until it runs
+ * dry, reporting the results into the provided sink. This way game data initialization happens once per worker, and
+ * not once per trace or per batch of traces.
+ *
+ * Traces are handed out to the workers dynamically, one at a time, so that a few long traces don't stall the whole
+ * run. If a worker process crashes, the trace it was working on is reported as not finished, and the remaining traces
+ * are distributed among the other workers.
+ *
+ * If `jobs` is less than two, or if the platform doesn't support `fork`, then `worker` is just run in the current
+ * process. On Windows a warning is printed in the latter case, as `-j` is not supported there.
+ *
+ * @param jobs                          Number of worker processes.
+ * @param taskCount                     Total number of traces.
+ * @param worker                        Worker function.
+ * @return                              Per-trace results.
+ */
+std::vector<RetraceResult> runRetraceJobs(int jobs, size_t taskCount, const RetraceWorker &worker);
+
+/**
+ * @param path                          Path to write JUnit XML report to.
+ * @param traces                        Trace paths.
+ * @param results                       Per-trace results, as returned from `runRetraceJobs`.
+ */
+void writeRetraceJUnitReport(const std::string &path, const std::vector<std::string> &traces,
+                             const std::vector<RetraceResult> &results);
+
+/**
+ * @param path                          Path to write JSON report to.
+ * @param traces                        Trace paths.
+ * @param results                       Per-trace results, as returned from `runRetraceJobs`.
+ */
+void writeRetraceJsonReport(const std::string &path, const std::vector<std::string> &traces,
+                            const std::vector<RetraceResult> &results);
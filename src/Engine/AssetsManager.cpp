@@ -12,7 +12,7 @@
 
 #include "Library/Logger/Logger.h"
 
-#include "Utility/String/Ascii.h"
+#include "Utility/String/NameAtom.h"
 
 AssetsManager *assets = new AssetsManager();
 
@@ -56,7 +56,7 @@ void AssetsManager::releaseAllTextures() {
 }
 
 bool AssetsManager::releaseImage(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
@@ -64,16 +64,16 @@ bool AssetsManager::releaseImage(std::string_view name) {
     }
 
     i->second->releaseRenderId();
-    images.erase(filename);
+    images.erase(i);
     return true;
 }
 
 GraphicsImage *AssetsManager::getImage_Paletted(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Paletted_Img_Loader>(pIcons_LOD, filename));
+        auto image = GraphicsImage::Create(std::make_unique<Paletted_Img_Loader>(pIcons_LOD, filename.str()));
         images[filename] = image;
         return image;
     }
@@ -83,11 +83,11 @@ GraphicsImage *AssetsManager::getImage_Paletted(std::string_view name) {
 
 
 GraphicsImage *AssetsManager::getImage_ColorKey(std::string_view name, Color colorkey) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<ColorKey_LOD_Loader>(pIcons_LOD, filename, colorkey));
+        auto image = GraphicsImage::Create(std::make_unique<ColorKey_LOD_Loader>(pIcons_LOD, filename.str(), colorkey));
         images[filename] = image;
         return image;
     }
@@ -98,11 +98,11 @@ GraphicsImage *AssetsManager::getImage_ColorKey(std::string_view name, Color col
 
 
 GraphicsImage *AssetsManager::getImage_Solid(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Image16bit_LOD_Loader>(pIcons_LOD, filename));
+        auto image = GraphicsImage::Create(std::make_unique<Image16bit_LOD_Loader>(pIcons_LOD, filename.str()));
         images[filename] = image;
         return image;
     }
@@ -111,11 +111,11 @@ GraphicsImage *AssetsManager::getImage_Solid(std::string_view name) {
 }
 
 GraphicsImage *AssetsManager::getImage_Alpha(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Alpha_LOD_Loader>(pIcons_LOD, filename));
+        auto image = GraphicsImage::Create(std::make_unique<Alpha_LOD_Loader>(pIcons_LOD, filename.str()));
         images[filename] = image;
         return image;
     }
@@ -124,11 +124,11 @@ GraphicsImage *AssetsManager::getImage_Alpha(std::string_view name) {
 }
 
 GraphicsImage *AssetsManager::getImage_PCXFromIconsLOD(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = images.find(filename);
     if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<PCX_LOD_Compressed_Loader>(pIcons_LOD, filename));
+        auto image = GraphicsImage::Create(std::make_unique<PCX_LOD_Compressed_Loader>(pIcons_LOD, filename.str()));
         images[filename] = image;
         return image;
     }
@@ -137,15 +137,15 @@ GraphicsImage *AssetsManager::getImage_PCXFromIconsLOD(std::string_view name) {
 }
 
 GraphicsImage *AssetsManager::getBitmap(std::string_view name, bool generated) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = bitmaps.find(filename);
     if (i == bitmaps.end()) {
         GraphicsImage *image = nullptr;
         if (generated) {
-            image = GraphicsImage::Create(std::make_unique<Bitmaps_GEN_Loader>(filename));
+            image = GraphicsImage::Create(std::make_unique<Bitmaps_GEN_Loader>(filename.str()));
         } else {
-            image = GraphicsImage::Create(std::make_unique<Bitmaps_LOD_Loader>(pBitmaps_LOD, filename));
+            image = GraphicsImage::Create(std::make_unique<Bitmaps_LOD_Loader>(pBitmaps_LOD, filename.str()));
         }
         bitmaps[filename] = image;
         return image;
@@ -155,7 +155,7 @@ GraphicsImage *AssetsManager::getBitmap(std::string_view name, bool generated) {
 }
 
 bool AssetsManager::releaseBitmap(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = bitmaps.find(filename);
     if (i == bitmaps.end()) {
@@ -163,16 +163,16 @@ bool AssetsManager::releaseBitmap(std::string_view name) {
     }
 
     i->second->releaseRenderId();
-    bitmaps.erase(filename);
+    bitmaps.erase(i);
     return true;
 }
 
 GraphicsImage *AssetsManager::getSprite(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = sprites.find(filename);
     if (i == sprites.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Sprites_LOD_Loader>(pSprites_LOD, filename));
+        auto image = GraphicsImage::Create(std::make_unique<Sprites_LOD_Loader>(pSprites_LOD, filename.str()));
         sprites[filename] = image;
         return image;
     }
@@ -181,7 +181,7 @@ GraphicsImage *AssetsManager::getSprite(std::string_view name) {
 }
 
 bool AssetsManager::releaseSprite(std::string_view name) {
-    std::string filename = ascii::toLower(name);
+    NameAtom filename(name);
 
     auto i = sprites.find(filename);
     if (i == sprites.end()) {
@@ -189,7 +189,7 @@ bool AssetsManager::releaseSprite(std::string_view name) {
     }
 
     i->second->releaseRenderId();
-    sprites.erase(filename);
+    sprites.erase(i);
     return true;
 }
 
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <memory>
 
 #include "Library/Color/ColorTable.h"
 #include "GUI/GUIFont.h"
 
+#include "Utility/String/NameAtom.h"
+
 class GraphicsImage;
 
 class AssetsManager {
@@ -46,9 +49,10 @@ class AssetsManager {
     std::unique_ptr<GUIFont> pFontSmallnum;
 
  protected:
-    std::unordered_map<std::string, GraphicsImage *> bitmaps;
-    std::unordered_map<std::string, GraphicsImage *> sprites;
-    std::unordered_map<std::string, GraphicsImage *> images;
+    // Keyed by atoms so that lookups don't have to allocate a lowercase copy of the name.
+    std::unordered_map<NameAtom, GraphicsImage *> bitmaps;
+    std::unordered_map<NameAtom, GraphicsImage *> sprites;
+    std::unordered_map<NameAtom, GraphicsImage *> images;
 };
 
 extern AssetsManager *assets;
@@ -8,8 +8,7 @@
 
 #include "EngineController.h"
 
-static void controlThread(EngineControlState *unsafeState) {
-    EngineControlStateHandle state(SIDE_CONTROL, unsafeState);
+static void controlLoop(EngineControlStateHandle state) {
     EngineController controller(state);
 
     while (true) {
@@ -19,6 +18,7 @@ static void controlThread(EngineControlState *unsafeState) {
         if (state->terminating)
             return;
 
+        std::exception_ptr exception;
         try {
             // std::queue uses std::deque which doesn't move elements around on reallocation, so we're safe even if
             // another control routine is queued from inside this call.
@@ -28,11 +28,16 @@ static void controlThread(EngineControlState *unsafeState) {
             // important to do this inside a try block as tick() throws.
             if (!state->postedEvents.empty())
                 controller.tick();
-            assert(state->postedEvents.empty()); // We assume that the main thread processes all events each tick.
+            assert(state->postedEvents.empty()); // We assume that the game side processes all events each tick.
         } catch (EngineControlState::TerminationException) {
             return;
         } catch (...) {
-            state->gameRoutine = [exception = std::current_exception()] {
+            exception = std::current_exception();
+        }
+
+        // Yielding from inside a catch block is not allowed, see Fiber docs. So we pass the exception on from here.
+        if (exception) {
+            state->gameRoutine = [exception] {
                 std::rethrow_exception(exception);
             };
             state.yieldExecution();
@@ -42,18 +47,22 @@ static void controlThread(EngineControlState *unsafeState) {
     }
 }
 
-EngineControlComponent::EngineControlComponent(): _unsafeState(std::make_unique<EngineControlState>()), _state(SIDE_GAME, _unsafeState.get()) {
+EngineControlComponent::EngineControlComponent():
+    _unsafeState(std::make_unique<EngineControlState>()),
+    _controlFiber(std::make_unique<Fiber>([this] {
+        controlLoop(EngineControlStateHandle(SIDE_CONTROL, _unsafeState.get(), _controlFiber.get()));
+    })),
+    _state(SIDE_GAME, _unsafeState.get(), _controlFiber.get()) {
     _emptyHandler = std::make_unique<PlatformEventHandler>();
-    _controlThread = std::thread(&controlThread, _unsafeState.get());
 }
 
 EngineControlComponent::~EngineControlComponent() {
     assert(!application()); // Should be uninstalled.
-    assert(!_controlThread.joinable()); // Thread should be joined at this point.
+    assert(_controlFiber->isFinished()); // Control fiber should be terminated at this point.
 }
 
 void EngineControlComponent::runControlRoutine(ControlRoutine routine) {
-    assert(std::this_thread::get_id() != _controlThread.get_id());
+    assert(!_controlFiber->isRunning());
 
     _state->controlRoutineQueue.push(std::move(routine));
 }
@@ -122,5 +131,5 @@ void EngineControlComponent::swapBuffers() {
 void EngineControlComponent::removeNotify() {
     _state->terminating = true;
     _state.yieldExecution();
-    _controlThread.join();
+    assert(_controlFiber->isFinished());
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <thread>
 #include <functional>
 #include <memory>
 
+#include "Library/Fiber/Fiber.h"
 #include "Library/Platform/Proxy/ProxyOpenGLContext.h"
 #include "Library/Platform/Proxy/ProxyEventLoop.h"
 #include "Library/Platform/Application/PlatformApplicationAware.h"
@@ -20,9 +20,9 @@ class PlatformEvent;
  * This component exposes a coroutine-like API that makes it possible to control the game by passing in synthetic
  * platform events.
  *
- * The implementation just uses a separate thread that runs a control routine, and the execution can switch between
- * threads from inside the `swapBuffers` call. This effectively means that the control routine runs in between game
- * frames.
+ * The implementation runs control routines inside a `Fiber` on the game thread, and the execution switches into the
+ * fiber from inside the `swapBuffers` call. This effectively means that the control routine runs in between game
+ * frames, and that it can safely touch game state directly.
  *
  * If the control component is destroyed while the control routine is still running, the control routine will be
  * terminated by throwing an exception from inside `EngineController`. If you use `catch(...)` inside the control
@@ -38,12 +38,12 @@ class EngineControlComponent : private ProxyOpenGLContext, private ProxyEventLoo
     virtual ~EngineControlComponent();
 
     /**
-     * Schedules a control routine for execution. It will be started in a control thread from inside the next
+     * Schedules a control routine for execution. It will be started in the control fiber from inside the next
      * `swapBuffers` call. All spontaneous (OS-generated) events will be blocked while the control routine is running.
      *
      * If another control routine is already running, passed routine will be added to the queue.
      *
-     * Don't call this function from a control thread, just call the control routine directly.
+     * Don't call this function from inside a control routine, just call the other control routine directly.
      *
      * Note that it's up to the user to set up a notification for when the control routine has finished.
      *
@@ -68,8 +68,8 @@ class EngineControlComponent : private ProxyOpenGLContext, private ProxyEventLoo
     virtual void removeNotify() override;
 
  private:
-    std::thread _controlThread;
     std::unique_ptr<EngineControlState> _unsafeState;
+    std::unique_ptr<Fiber> _controlFiber;
     EngineControlStateHandle _state;
     std::unique_ptr<PlatformEventHandler> _emptyHandler;
 };
@@ -2,7 +2,6 @@
 
 #include <cassert>
 #include <utility>
-#include <thread>
 #include <string>
 #include <memory>
 
@@ -59,7 +58,7 @@ void EngineController::tick(int count) {
         _state.yieldExecution();
 
         // We should check `terminating` after a call to `yieldExecution` because it cannot be set before the call -
-        // the only place it's set is the main thread, and main thread wasn't running before the call.
+        // the only place it's set is the game side, and the game side wasn't running before the call.
         if (_state->terminating)
             throw EngineControlState::TerminationException();
     }
@@ -218,15 +217,16 @@ void EngineController::skipLoadingScreen() {
 }
 
 Blob EngineController::saveGame() {
-    // AutoSave makes a screenshot and needs the opengl context that's bound in game thread, so we cannot call it from
-    // the control thread. One option is to unbind every time we switch to control thread, but this is slow, and not
-    // needed 99% of the time. So we just call back into the game thread.
+    // AutoSave makes a screenshot and goes deep into the renderer. Control routines run in between frames, in the
+    // middle of a swapBuffers call, so we don't do this from the control fiber and just call back into the game side.
     Blob result;
     runGameRoutine([&] { result = CreateSaveData(false, "").second; });
     return result;
 }
 
 void EngineController::loadGame(const Blob &savedGame) {
+    runGameRoutine([] { FinishPendingSave(); }); // Pending save should go into the current ufs.
+
     MemoryFileSystem ramFs("ramfs");
     ramFs.write("saves/!!!save.mm7", savedGame);
 
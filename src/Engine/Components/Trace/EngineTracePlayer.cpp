@@ -13,9 +13,11 @@
 #include "Engine/Random/Random.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineFileSystem.h"
+#include "Engine/SaveLoad.h"
 
 #include "Library/Trace/PaintEvent.h"
 #include "Library/Trace/EventTrace.h"
+#include "Library/Trace/EventTraceBinary.h"
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/FileSystem/Memory/MemoryFileSystem.h"
 
@@ -37,7 +39,16 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
     assert(!isPlaying());
 
     _flags = flags;
-    _trace = std::make_unique<EventTrace>(EventTrace::fromJsonBlob(recording.trace, application()->window()));
+
+    // Binary traces are streamed, we only parse the header upfront.
+    std::unique_ptr<EventTraceReader> reader;
+    if (EventTraceReader::isBinaryTrace(recording.trace)) {
+        reader = std::make_unique<EventTraceReader>(recording.trace, application()->window());
+        _trace = std::make_unique<EventTrace>();
+        _trace->header = reader->header();
+    } else {
+        _trace = std::make_unique<EventTrace>(EventTrace::fromJsonBlob(recording.trace, application()->window()));
+    }
 
     MM_AT_SCOPE_EXIT({
         _flags = 0;
@@ -71,7 +82,12 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
     ScopedRollback<FileSystem *> rollback(&ufs, &ramFs);
 
     checkState(recording, _trace->header.startState, true);
-    component<EngineTraceSimplePlayer>()->playTrace(game, std::move(_trace->events), recording.trace.displayPath(), _flags);
+    if (reader) {
+        component<EngineTraceSimplePlayer>()->playTrace(game, reader.get(), recording.trace.displayPath(), _flags);
+    } else {
+        component<EngineTraceSimplePlayer>()->playTrace(game, std::move(_trace->events), recording.trace.displayPath(), _flags);
+    }
+    game->runGameRoutine([] { FinishPendingSave(); }); // Autosaves made by the trace should go into ramfs.
     checkState(recording, _trace->header.endState, false);
 }
 
@@ -9,6 +9,7 @@
 #include "Engine/Random/Random.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
+#include "Library/Trace/EventTraceBinary.h"
 #include "Library/Trace/PaintEvent.h"
 
 #include "Utility/ScopeGuard.h"
@@ -27,16 +28,33 @@ void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std:
     _traceDisplayPath = traceDisplayPath;
     _flags = flags;
 
-    for (std::unique_ptr<PlatformEvent> &event : events) {
-        if (event->type == EVENT_PAINT) {
-            game->tick(1);
+    for (std::unique_ptr<PlatformEvent> &event : events)
+        playEvent(game, std::move(event));
+}
+
+void EngineTraceSimplePlayer::playTrace(EngineController *game, EventTraceReader *reader,
+                                        std::string_view traceDisplayPath, EngineTracePlaybackFlags flags) {
+    assert(!isPlaying());
+
+    _playing = true;
+    MM_AT_SCOPE_EXIT(_playing = false);
+
+    _traceDisplayPath = traceDisplayPath;
+    _flags = flags;
+
+    while (std::unique_ptr<PlatformEvent> event = reader->read())
+        playEvent(game, std::move(event));
+}
+
+void EngineTraceSimplePlayer::playEvent(EngineController *game, std::unique_ptr<PlatformEvent> event) {
+    if (event->type == EVENT_PAINT) {
+        game->tick(1);
 
-            const PaintEvent *paintEvent = static_cast<const PaintEvent *>(event.get());
-            checkTime(paintEvent);
-            checkRng(paintEvent);
-        } else {
-            game->postEvent(std::move(event));
-        }
+        const PaintEvent *paintEvent = static_cast<const PaintEvent *>(event.get());
+        checkTime(paintEvent);
+        checkRng(paintEvent);
+    } else {
+        game->postEvent(std::move(event));
     }
 }
 
@@ -9,6 +9,7 @@
 #include "EngineTraceEnums.h"
 
 class EngineController;
+class EventTraceReader;
 class PaintEvent;
 class PlatformEvent;
 
@@ -35,6 +36,18 @@ class EngineTraceSimplePlayer : private PlatformApplicationAware {
     void playTrace(EngineController *game, std::vector<std::unique_ptr<PlatformEvent>> events,
                    std::string_view traceDisplayPath, EngineTracePlaybackFlags flags);
 
+    /**
+     * Same as above, but pulls events from the provided reader one by one, so that the whole trace doesn't need to be
+     * parsed upfront.
+     *
+     * @param game                      Engine controller.
+     * @param reader                    Binary trace reader to play events from.
+     * @param traceDisplayPath          Path to trace file. Used only for error reporting.
+     * @param flags                     Playback flags.
+     */
+    void playTrace(EngineController *game, EventTraceReader *reader, std::string_view traceDisplayPath,
+                   EngineTracePlaybackFlags flags);
+
     bool isPlaying() const {
         return _playing;
     }
@@ -42,6 +55,7 @@ class EngineTraceSimplePlayer : private PlatformApplicationAware {
  private:
     friend class PlatformIntrospection; // Give access to private bases.
 
+    void playEvent(EngineController *game, std::unique_ptr<PlatformEvent> event);
     void checkTime(const PaintEvent *paintEvent);
     void checkRng(const PaintEvent *paintEvent);
 
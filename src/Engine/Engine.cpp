@@ -2,6 +2,8 @@
 #include <string>
 #include <algorithm>
 #include <memory>
+#include <chrono>
+#include <thread>
 
 #include "Engine/Engine.h"
 
@@ -32,6 +34,7 @@
 #include "Engine/Graphics/TurnBasedOverlay.h"
 #include "Engine/LodTextureCache.h"
 #include "Engine/LodSpriteCache.h"
+#include "Engine/LodRegistry.h"
 #include "Engine/Localization.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/Chest.h"
@@ -82,6 +85,7 @@
 #include "Io/Mouse.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/TaskGraph/TaskGraph.h"
 #include "Library/BuildInfo/BuildInfo.h"
 #include "Tables/ChestTable.h"
 
@@ -127,7 +131,7 @@ torchB.icon->texture->GetWidth()) / 640.0f, 48 / 480.0f, icon->texture);
 Engine *engine;
 GameState uGameState;
 
-void Engine::drawWorld() {
+void Engine::updateCamera() {
     engine->SetSaturateFaces(pParty->checkPartyPerceptionAgainstCurrentMap());
 
     pCamera3D->_viewPitch = pParty->_viewPitch;
@@ -139,6 +143,26 @@ void Engine::drawWorld() {
     pCamera3D->CalculateRotations(pParty->_viewYaw, pParty->_viewPitch);
     pCamera3D->CreateViewMatrixAndProjectionScale();
     pCamera3D->BuildViewFrustum();
+}
+
+void Engine::updatePartyPreviousView() {
+    // This is game state, not drawing, so it's updated even on frames that don't get drawn.
+    if (pMovie_Track)
+        return;
+
+    if (pParty->pos != pParty->lastPos ||
+        pParty->_viewYaw != pParty->_viewPrevYaw ||
+        pParty->_viewPitch != pParty->_viewPrevPitch ||
+        pParty->eyeLevel != pParty->lastEyeLevel)
+        pParty->lastPos = pParty->pos;
+    pParty->_viewPrevYaw = pParty->_viewYaw;
+    pParty->_viewPrevPitch = pParty->_viewPitch;
+    pParty->lastEyeLevel = pParty->eyeLevel;
+}
+
+void Engine::drawWorld() {
+    updateCamera();
+    updatePartyPreviousView();
 
     if (pMovie_Track) {
         /*if ( !render->pRenderD3D )
@@ -148,16 +172,6 @@ void Engine::drawWorld() {
         render->DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene();
         }*/
     } else {
-        if (pParty->pos != pParty->lastPos ||
-            pParty->_viewYaw != pParty->_viewPrevYaw ||
-            pParty->_viewPitch != pParty->_viewPrevPitch ||
-            pParty->eyeLevel != pParty->lastEyeLevel)
-            pParty->lastPos = pParty->pos;
-        // v0 = &render;
-        pParty->_viewPrevYaw = pParty->_viewYaw;
-        pParty->_viewPrevPitch = pParty->_viewPitch;
-
-        pParty->lastEyeLevel = pParty->eyeLevel;
         render->BeginScene3D();
 
         // if ( !render->pRenderD3D )
@@ -203,6 +217,12 @@ void Engine::drawHUD() {
 
 //----- (0044103C) --------------------------------------------------------
 void Engine::Draw() {
+    if (drawInterval != 1 && (drawInterval == 0 || ++framesSinceDraw < drawInterval)) {
+        simulateDraw();
+        return;
+    }
+    framesSinceDraw = 0;
+
     drawWorld();
     drawHUD();
     render->flushAndScale();
@@ -210,6 +230,25 @@ void Engine::Draw() {
     render->swapBuffers();
 }
 
+void Engine::simulateDraw() {
+    // Skip world & HUD rendering, but still run the parts of the frame that affect game state. Note that this still
+    // isn't fully equivalent to a normal frame - draw lists that are used for mouse picking and viewport queries are
+    // not rebuilt.
+    updateCamera();
+    updatePartyPreviousView();
+
+    // Party sectors are normally updated when preparing indoor draw lists, and they feed into actor AI.
+    if (!pMovie_Track && !PauseGameDrawing() && uCurrentlyLoadedLevelType == LEVEL_INDOOR)
+        pBLVRenderParams->updatePartySectors();
+
+    // GUI window updates both update state & draw, so they have to run inside a proper 2D scene. 2D draws are cheap
+    // compared to the world, so we just draw them as usual.
+    render->BeginScene2D();
+    GUI_UpdateWindows();
+    pParty->updateCharactersAndHirelingsEmotions();
+    render->flushAndScale();
+    render->swapBuffers();
+}
 
 void Engine::DrawGUI() {
     render->ResetUIClipRect();
@@ -277,6 +316,13 @@ void Engine::DrawGUI() {
                                  fmt::format("Party yaw/pitch:     {} {}", pParty->_viewYaw, pParty->_viewPitch));
         debug_info_offset += 16;
 
+        GeometryCacheStats geometryStats = render->geometryCacheStats();
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Geometry upload:     {} faces, {} vertex bytes, {} index bytes",
+                                             geometryStats.facesRebuilt, geometryStats.vertexBytesUploaded,
+                                             geometryStats.indexBytesUploaded));
+        debug_info_offset += 16;
+
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
             int sector_id = pBLVRenderParams->uPartySectorID;
             pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
@@ -604,7 +650,7 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     engine->_transitionMapId = MAP_INVALID;
     onMapLoad();
     pGameLoadingUI_ProgressBar->Progress();
-    memset(&render->pBillboardRenderListD3D, 0, sizeof(render->pBillboardRenderListD3D));
+    render->clearBillboardsD3D();
     pGameLoadingUI_ProgressBar->Release();
 }
 
@@ -627,21 +673,42 @@ void MM7_LoadLods() {
     engine->_gameResourceManager->openGameResources();
 
     pIcons_LOD = new LodTextureCache;
-    pIcons_LOD->open(dfs->read("data/icons.lod"));
+    pIcons_LOD->open(pLodRegistry->open("data/icons.lod"));
 
     pBitmaps_LOD = new LodTextureCache;
-    pBitmaps_LOD->open(dfs->read("data/bitmaps.lod"));
+    pBitmaps_LOD->open(pLodRegistry->open("data/bitmaps.lod"));
 
     pSprites_LOD = new LodSpriteCache;
-    pSprites_LOD->open(dfs->read("data/sprites.lod"));
+    pSprites_LOD->open(pLodRegistry->open("data/sprites.lod"));
 
     // TODO(captainurist):
     // on error in `open` we had this:
     // Error(localization->GetString(LSTR_MIGHT_AND_MAGIC_VII_IS_HAVING_TROUBLE), localization->GetString(LSTR_REINSTALL_NECESSARY));
     // however, at this point localization isn't initialized yet, so this was a guaranteed crash.
     // Implement proper user-facing error reporting!
+}
+
+// Init tasks are mostly IO & parsing, so going wider than this doesn't really help.
+static constexpr int MAX_AUTO_INIT_THREADS = 8;
 
-    pPaletteManager->load(pBitmaps_LOD);
+static void runInitTasks(std::string_view stage, const GameConfig *config, TaskGraph *graph) {
+    int threadCount = config->debug.InitThreads.value();
+    if (threadCount == 0)
+        threadCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, MAX_AUTO_INIT_THREADS);
+    size_t workerCount = threadCount - 1; // Calling thread also runs tasks.
+
+    TaskGraph::Clock::time_point start = TaskGraph::Clock::now();
+    graph->run(workerCount);
+    TaskGraph::Clock::duration total = TaskGraph::Clock::now() - start;
+
+    auto toMs = [](TaskGraph::Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    };
+    for (const TaskGraph::TaskTiming &timing : graph->timings())
+        logger->debug("{}: task '{}' started at {}ms, took {}ms.",
+                      stage, timing.name, toMs(timing.start), toMs(timing.duration));
+    logger->info("{}: {} tasks done in {}ms using {} worker threads.",
+                 stage, graph->timings().size(), toMs(total), workerCount);
 }
 
 //----- (004651F4) --------------------------------------------------------
@@ -666,8 +733,16 @@ void Engine::MM7_Initialize() {
 
     MM7_LoadLods();
 
-    localization = new Localization();
-    localization->Initialize();
+    // Everything here only reads from the LODs, and writes into its own table. The only shared state that's written
+    // to is the global NameAtom table that the name indices are built on, and it's thread-safe. Note that LODs are
+    // read through GameResourceManager & LodRegistry, which are thread-safe, and not through dfs, which is not.
+    TaskGraph graph;
+
+    graph.addMainThreadTask("palettes", [] { pPaletteManager->load(pBitmaps_LOD); });
+    graph.addTask("localization", [] {
+        localization = new Localization();
+        localization->Initialize();
+    });
 
     auto triLoad = [](std::string_view name) {
         TriBlob result;
@@ -676,35 +751,25 @@ void Engine::MM7_Initialize() {
         return result;
     };
 
-    pSpriteFrameTable = new SpriteFrameTable;
-    deserialize(triLoad("dsft.bin"), pSpriteFrameTable);
-
-    pTextureFrameTable = new TextureFrameTable;
-    deserialize(triLoad("dtft.bin"), pTextureFrameTable);
-
-    pTileTable = new TileTable;
-    deserialize(triLoad("dtile.bin"), pTileTable);
-
-    pPortraitFrameTable = new PortraitFrameTable;
-    deserialize(triLoad("dpft.bin"), pPortraitFrameTable);
-
-    pIconsFrameTable = new IconFrameTable;
-    deserialize(triLoad("dift.bin"), pIconsFrameTable);
-
-    pDecorationList = new DecorationList;
-    deserialize(triLoad("ddeclist.bin"), pDecorationList);
-
-    pObjectList = new ObjectList;
-    deserialize(triLoad("dobjlist.bin"), pObjectList);
-
-    pMonsterList = new MonsterList;
-    deserialize(triLoad("dmonlist.bin"), pMonsterList);
+    auto addTableTask = [&]<class Table>(std::string_view name, Table **table) {
+        graph.addTask(std::string(name), [=] {
+            *table = new Table;
+            deserialize(triLoad(name), *table);
+        });
+    };
 
-    pOverlayList = new OverlayList;
-    deserialize(triLoad("doverlay.bin"), pOverlayList);
+    addTableTask("dsft.bin", &pSpriteFrameTable);
+    addTableTask("dtft.bin", &pTextureFrameTable);
+    addTableTask("dtile.bin", &pTileTable);
+    addTableTask("dpft.bin", &pPortraitFrameTable);
+    addTableTask("dift.bin", &pIconsFrameTable);
+    addTableTask("ddeclist.bin", &pDecorationList);
+    addTableTask("dobjlist.bin", &pObjectList);
+    addTableTask("dmonlist.bin", &pMonsterList);
+    addTableTask("doverlay.bin", &pOverlayList);
+    addTableTask("dsounds.bin", &pSoundList);
 
-    pSoundList = new SoundList;
-    deserialize(triLoad("dsounds.bin"), pSoundList);
+    runInitTasks("MM7_Initialize", config.get(), &graph);
 
     if (!config->debug.NoSound.value())
         pAudioPlayer->Initialize();
@@ -723,31 +788,58 @@ void Engine::MM7_Initialize() {
 void Engine::SecondaryInitialization() {
     mouse->Initialize();
 
-    pMapStats = new MapStats();
-    pMapStats->Initialize(engine->_gameResourceManager->getEventsFile("MapStats.txt"));
-
-    pMonsterStats = new MonsterStats();
-    pMonsterStats->Initialize(engine->_gameResourceManager->getEventsFile("monsters.txt"));
-    pMonsterStats->InitializePlacements(engine->_gameResourceManager->getEventsFile("placemon.txt"));
-
-    pSpellStats = new SpellStats();
-    pSpellStats->Initialize(engine->_gameResourceManager->getEventsFile("spells.txt"));
-
-    pFactionTable = new FactionTable();
-    pFactionTable->Initialize(engine->_gameResourceManager->getEventsFile("hostile.txt"));
-
-    pHistoryTable = new HistoryTable();
-    pHistoryTable->Initialize(engine->_gameResourceManager->getEventsFile("history.txt"));
-
-    pItemTable = new ItemTable();
-    pItemTable->Initialize(engine->_gameResourceManager.get());
-
-    initializeHouses(engine->_gameResourceManager->getEventsFile("2dEvents.txt"));
+    // Text tables are loaded on worker threads, everything that touches the assets is loaded on the main thread.
+    // See the comment in MM7_Initialize.
+    GameResourceManager *resources = engine->_gameResourceManager.get();
+    TaskGraph graph;
+
+    graph.addTask("MapStats.txt", [=] {
+        pMapStats = new MapStats();
+        pMapStats->Initialize(resources->getEventsFile("MapStats.txt"));
+    });
+    graph.addTask("monsters.txt", [=] {
+        pMonsterStats = new MonsterStats();
+        pMonsterStats->Initialize(resources->getEventsFile("monsters.txt"));
+        pMonsterStats->InitializePlacements(resources->getEventsFile("placemon.txt"));
+    });
+    graph.addTask("spells.txt", [=] {
+        pSpellStats = new SpellStats();
+        pSpellStats->Initialize(resources->getEventsFile("spells.txt"));
+    });
+    graph.addTask("hostile.txt", [=] {
+        pFactionTable = new FactionTable();
+        pFactionTable->Initialize(resources->getEventsFile("hostile.txt"));
+    });
+    graph.addTask("history.txt", [=] {
+        pHistoryTable = new HistoryTable();
+        pHistoryTable->Initialize(resources->getEventsFile("history.txt"));
+    });
+    graph.addTask("items.txt", [=] {
+        pItemTable = new ItemTable();
+        pItemTable->Initialize(resources);
+    });
+    graph.addTask("2dEvents.txt", [=] { initializeHouses(resources->getEventsFile("2dEvents.txt")); });
+    graph.addTask("npcdata.txt", [=] {
+        pNPCStats = new NPCStats();
+        pNPCStats->Initialize(resources);
+    });
+    graph.addTask("quests.txt", [=] { initializeQuests(resources->getEventsFile("quests.txt")); });
+    graph.addTask("autonote.txt", [=] { initializeAutonotes(resources->getEventsFile("autonote.txt")); });
+    graph.addTask("awards.txt", [=] { initializeAwards(resources->getEventsFile("awards.txt")); });
+    graph.addTask("trans.txt", [=] { initializeTransitions(resources->getEventsFile("trans.txt")); });
+    graph.addTask("merchant.txt", [=] { initializeMerchants(resources->getEventsFile("merchant.txt")); });
+    graph.addTask("scroll.txt", [=] { initializeMessageScrolls(resources->getEventsFile("scroll.txt")); });
+    graph.addTask("chests", [] { initializeChests(); });
+    graph.addTask("global.evt", [=] {
+        engine->_globalEventMap = EvtProgram::load(resources->getEventsFile("global.evt"));
+    });
 
     //pPaletteManager->SetMistColor(128, 128, 128);
     //pPaletteManager->RecalculateAll();
-    pObjectList->InitializeSprites();
-    pOverlayList->InitializeSprites();
+    graph.addMainThreadTask("sprites", [] {
+        pObjectList->InitializeSprites();
+        pOverlayList->InitializeSprites();
+    });
 
     // TODO(captainurist): try resurrecting the food / gold animations using resource files from MM6?
     //for (unsigned i = 0; i < 4; ++i) {
@@ -764,27 +856,16 @@ void Engine::SecondaryInitialization() {
     //}
 
     // TODO(pskelton): dropping this causes std::bad_alloc in headless mode
-    UI_Create();
-
-    spell_fx_renedrer->LoadAnimations();
-
-    for (unsigned i = 0; i < 7; ++i) {
-        std::string container_name = fmt::format("HDWTR{:03}", i);
-        render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
-    }
-
-    pNPCStats = new NPCStats();
-    pNPCStats->Initialize(engine->_gameResourceManager.get());
-
-    initializeQuests(engine->_gameResourceManager->getEventsFile("quests.txt"));
-    initializeAutonotes(engine->_gameResourceManager->getEventsFile("autonote.txt"));
-    initializeAwards(engine->_gameResourceManager->getEventsFile("awards.txt"));
-    initializeTransitions(engine->_gameResourceManager->getEventsFile("trans.txt"));
-    initializeMerchants(engine->_gameResourceManager->getEventsFile("merchant.txt"));
-    initializeMessageScrolls(engine->_gameResourceManager->getEventsFile("scroll.txt"));
-    initializeChests();
+    graph.addMainThreadTask("UI_Create", [] { UI_Create(); });
+    graph.addMainThreadTask("spell animations", [this] { spell_fx_renedrer->LoadAnimations(); });
+    graph.addMainThreadTask("water", [] {
+        for (unsigned i = 0; i < 7; ++i) {
+            std::string container_name = fmt::format("HDWTR{:03}", i);
+            render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
+        }
+    });
 
-    engine->_globalEventMap = EvtProgram::load(engine->_gameResourceManager->getEventsFile("global.evt"));
+    runInitTasks("SecondaryInitialization", config.get(), &graph);
 
     pBitmaps_LOD->reserveLoadedTextures();
     pSprites_LOD->reserveLoadedSprites();
@@ -856,7 +937,7 @@ void Engine::ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows() {
     }
 
     // Render billboards are used in hit tests, but we're releasing textures, so can't use them anymore.
-    render->uNumBillboardsToDraw = 0;
+    render->clearBillboardsD3D();
 
     pBitmaps_LOD->releaseUnreserved();
     pSprites_LOD->releaseUnreserved();
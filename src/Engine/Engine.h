@@ -87,6 +87,9 @@ class Engine {
     void StackPartyTorchLight();
     void DrawParticles();
     void Draw();
+    void simulateDraw();
+    void updateCamera();
+    void updatePartyPreviousView();
     void drawWorld();
     void drawHUD();
     void drawOverlay();
@@ -117,6 +120,8 @@ class Engine {
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renedrer = nullptr;
     EngineCallObserver *callObserver = nullptr;
+    int drawInterval = 1; // Draw every n-th frame, other frames only run the game state updates. 0 means never draw.
+    int framesSinceDraw = 0;
     std::shared_ptr<Io::Mouse> mouse;
     std::shared_ptr<ParticleEngine> particle_engine;
     Vis *vis = nullptr;
@@ -2,3 +2,4 @@
 
 FileSystem *dfs = nullptr;
 FileSystem *ufs = nullptr;
+FileSystem *cfs = nullptr;
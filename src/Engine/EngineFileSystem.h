@@ -4,3 +4,4 @@
 
 extern FileSystem *dfs;
 extern FileSystem *ufs;
+extern FileSystem *cfs; // Cache file system, for derived data that can be rebuilt from `dfs` at any time. Can be null.
@@ -1,4 +1,5 @@
 #include <string>
+#include <string_view>
 #include <utility>
 #include <functional>
 
@@ -110,21 +111,11 @@ static tl::generator<Character &> iterateCharacters(EvtTargetCharacter who, Rand
     }
 }
 
-int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
-    EvtInstruction ir;
-    bool stepFound = false;
-
-    for (const EvtInstruction &irTmp : _events) {
-        if (irTmp.step == step) {
-            ir = irTmp;
-            stepFound = true;
-            break;
-        }
-    }
-
-    if (!stepFound) {
-        return -1;
-    }
+int EvtInterpreter::executeOneEvent(int index, bool isNpc) {
+    const EvtInstruction &ir = _function->instructions[index];
+    int step = ir.step;
+    int nextIndex = _function->nextIndices[index];
+    int targetIndex = _function->targetIndices[index];
 
     // In NPC mode must process only NPC dialogue related events plus Exit
     if (isNpc) {
@@ -135,7 +126,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
                 _readyToExit = true;
                 for (Character &player : pParty->pCharacters) {
                     if (player.CompareVariable(ir.data.variable_descr.type, ir.data.variable_descr.value)) {
-                        return ir.target_step;
+                        return targetIndex;
                     }
                 }
                 break;
@@ -150,14 +141,14 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
                 assert(false);
 #if 0
                 if (Actor::isActorKilled(ir.data.actor_descr.policy, ir.data.actor_descr.param, ir.data.actor_descr.num)) {
-                    return ir.target_step;
+                    return targetIndex;
                 }
 #endif
                 break;
             default:
                 break;
         }
-        return step + 1;
+        return nextIndex;
     }
 
     switch (ir.opcode) {
@@ -185,14 +176,18 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
         case EVENT_MoveToMap:
         {
-            if (ir.data.move_map_descr.house_id != HOUSE_INVALID || ir.data.move_map_descr.exit_pic_id) {
+            // Copied because of the data fixups below, instructions in the event map are immutable.
+            auto moveMap = ir.data.move_map_descr;
+            std::string_view mapName = ir.str;
+
+            if (moveMap.house_id != HOUSE_INVALID || moveMap.exit_pic_id) {
                 // TODO(pskelton): Fix #1890 this should be a data mod
                 if (engine->_indoor->filename == "d20.blv" && _eventId == 501)
-                    ir.data.move_map_descr.z = 3088;
+                    moveMap.z = 3088;
 
-                pDialogueWindow = new GUIWindow_IndoorEntryExit(ir.data.move_map_descr.house_id, ir.data.move_map_descr.exit_pic_id,
-                                                                Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, ir.data.move_map_descr.z),
-                                                                ir.data.move_map_descr.yaw, ir.data.move_map_descr.pitch, ir.data.move_map_descr.zspeed, ir.str);
+                pDialogueWindow = new GUIWindow_IndoorEntryExit(moveMap.house_id, moveMap.exit_pic_id,
+                                                                Vec3f(moveMap.x, moveMap.y, moveMap.z),
+                                                                moveMap.yaw, moveMap.pitch, moveMap.zspeed, mapName);
                 savedEventID = _eventId;
                 savedEventStep = step + 1;
                 return -1;
@@ -200,15 +195,15 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
 
             // TODO(pskelton): Fix #2117 this should be a data mod - stop it overwriting the teleport point
             if (!(engine->_indoor->filename == "d25.blv" && _eventId == 451 && engine->_teleportPoint.isValid()))
-                engine->_teleportPoint.setTeleportTarget(Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, ir.data.move_map_descr.z),
-                                                     (ir.data.move_map_descr.yaw != -1) ? (ir.data.move_map_descr.yaw & TrigLUT.uDoublePiMask) : -1,
-                                                     ir.data.move_map_descr.pitch, ir.data.move_map_descr.zspeed);
+                engine->_teleportPoint.setTeleportTarget(Vec3f(moveMap.x, moveMap.y, moveMap.z),
+                                                     (moveMap.yaw != -1) ? (moveMap.yaw & TrigLUT.uDoublePiMask) : -1,
+                                                     moveMap.pitch, moveMap.zspeed);
 
             // TODO(pskelton): Fix #2117 this should be a data mod
             if (engine->_indoor->filename == "d25.blv" && _eventId == 451 && ir.step == 1)
-                ir.str = "out06.odm";
+                mapName = "out06.odm";
 
-            if (ir.str[0] == '0') { // teleport within map
+            if (mapName.starts_with('0')) { // teleport within map
                 if (engine->_teleportPoint.isValid()) {
                     engine->_teleportPoint.doTeleport(false);
                     engine->_teleportPoint.invalidate();
@@ -216,7 +211,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
                 }
             } else {
                 pGameLoadingUI_ProgressBar->Initialize((GUIProgressBar::Type)((activeLevelDecoration == NULL) + 1));
-                Transition_StopSound_Autosave(ir.str, MAP_START_POINT_PARTY);
+                Transition_StopSound_Autosave(mapName, MAP_START_POINT_PARTY);
                 _mapExitTriggered = true;
                 if (current_screen_type == SCREEN_HOUSE) {
                     if (uGameState == GAME_STATE_CHANGE_LOCATION) {
@@ -302,7 +297,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
         case EVENT_Compare:
             for (Character &character : iterateCharacters(_who, grng))
                 if (character.CompareVariable(ir.data.variable_descr.type, ir.data.variable_descr.value))
-                    return ir.target_step;
+                    return targetIndex;
             break;
         case EVENT_ChangeDoorState:
             switchDoorAnimation(ir.data.door_descr.door_id, ir.data.door_descr.door_action);
@@ -356,7 +351,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             Actor::toggleFlag(ir.data.actor_flag_descr.id, ir.data.actor_flag_descr.attr, ir.data.actor_flag_descr.is_set);
             break;
         case EVENT_RandomGoTo:
-            return ir.data.random_goto_descr.random_goto[grng->random(ir.data.random_goto_descr.random_goto_len)];
+            return _function->indexOf(ir.data.random_goto_descr.random_goto[grng->random(ir.data.random_goto_descr.random_goto_len)]);
         case EVENT_InputString:
             // Originally starting step was checked to ensure skipping this command when returning from dialogue.
             // Changed to using "step + 1" to go to next event
@@ -408,7 +403,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             _who = ir.who;
             break;
         case EVENT_Jmp:
-            return ir.target_step;
+            return targetIndex;
         case EVENT_OnMapReload:
             // Trigger, must be skipped but can be encountered in vanilla
             return -1;
@@ -479,7 +474,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             for (Character &character : iterateCharacters(_who, grng)) {
                 CombinedSkillValue val = character.getSkillValue(ir.data.check_skill_descr.skill_type);
                 if (val.level() >= ir.data.check_skill_descr.skill_level && val.mastery() == ir.data.check_skill_descr.skill_mastery)
-                    return ir.target_step;
+                    return targetIndex;
             }
             break;
         case EVENT_SetNPCGroupNews:
@@ -505,7 +500,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
         case EVENT_IsActorKilled:
             if (Actor::isActorKilled(ir.data.actor_descr.policy, ir.data.actor_descr.param, ir.data.actor_descr.num)) {
-                return ir.target_step;
+                return targetIndex;
             }
             break;
         case EVENT_OnMapLeave:
@@ -537,7 +532,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
         case EVENT_CheckSeason:
             if (checkSeason(ir.data.season)) {
-                return ir.target_step;
+                return targetIndex;
             }
             break;
         case EVENT_ToggleActorGroupFlag:
@@ -589,22 +584,22 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
     }
 
-    return step + 1;
+    return nextIndex;
 }
 
 bool EvtInterpreter::executeRegular(int startStep) {
     assert(startStep >= 0);
 
-    if (!_eventId || !_events.size()) {
+    if (!_eventId || !isValid()) {
         return false;
     }
 
-    int step = startStep;
+    int index = _function->indexOf(startStep);
 
     _who = !pParty->hasActiveCharacter() ? CHOOSE_RANDOM : CHOOSE_ACTIVE;
 
-    while (step != -1 && dword_5B65C4_cancelEventProcessing == 0) {
-        step = executeOneEvent(step, false);
+    while (index != -1 && dword_5B65C4_cancelEventProcessing == 0) {
+        index = executeOneEvent(index, false);
     }
 
     return _mapExitTriggered;
@@ -617,18 +612,18 @@ bool EvtInterpreter::executeNpcDialogue(int startStep) {
         return false;
     }
 
-    if (!_events.size()) {
+    if (!isValid()) {
         // No event commands found for current eventId
         // In this case dialogue elements can be showed
         return true;
     }
 
-    int step = startStep;
+    int index = _function->indexOf(startStep);
 
     _who = CHOOSE_PARTY;
 
-    while (step != -1) {
-        step = executeOneEvent(step, true);
+    while (index != -1) {
+        index = executeOneEvent(index, true);
     }
 
     // Originally was: "readyToExit ? (canShowOption != 0) : 2"
@@ -640,12 +635,12 @@ void EvtInterpreter::prepare(const EvtProgram &eventMap, int eventId, Pid object
     _canShowMessages = canShowMessages;
     _objectPid = objectPid;
 
-    _events.clear();
+    _function = nullptr;
     if (eventMap.hasEvent(eventId)) {
-        _events = eventMap.function(eventId);
+        _function = &eventMap.function(eventId);
     }
 }
 
 bool EvtInterpreter::isValid() {
-    return _events.size() > 0;
+    return _function && !_function->instructions.empty();
 }
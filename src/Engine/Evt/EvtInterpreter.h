@@ -1,7 +1,5 @@
 #pragma once
 
-#include <vector>
-
 #include "Engine/Pid.h"
 #include "Engine/Evt/EvtInstruction.h"
 #include "Engine/Evt/EvtProgram.h"
@@ -18,11 +16,16 @@ class EvtInterpreter {
      bool isValid();
 
  protected:
-     int executeOneEvent(int step, bool isNpc);
+     /**
+      * @param index                    Index of the instruction to execute in the current script.
+      * @param isNpc                    Whether only NPC dialogue instructions should be executed.
+      * @return                         Index of the next instruction to execute, or `-1` if execution should stop.
+      */
+     int executeOneEvent(int index, bool isNpc);
 
  private:
      int _eventId = 0;
-     std::vector<EvtInstruction> _events;
+     const EvtFunction *_function = nullptr; // Points into the event map passed to `prepare`.
      Pid _objectPid = Pid();
      bool _canShowMessages = false;
      bool _canShowOption = true;
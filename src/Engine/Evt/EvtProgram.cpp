@@ -1,5 +1,6 @@
 #include "EvtProgram.h"
 
+#include <algorithm>
 #include <ranges>
 #include <tuple>
 #include <vector>
@@ -30,62 +31,89 @@ EvtProgram EvtProgram::load(const Blob &rawData) {
             throw Exception("Encountered corrupted evt binary data");
         SequentialBlobReader sbr(pos + 1, size - 1); // offset is 1 because we are skipping the `size` byte - it was already read
         int eventId = sbr.read<uint16_t>();
-        result.add(eventId, EvtInstruction::parse(sbr, size));
+        result._eventsById[eventId].instructions.push_back(EvtInstruction::parse(sbr, size));
         pos += size;
     }
 
+    for (auto &[_, function] : result._eventsById)
+        function.compile();
+    result.rebuildTriggers();
+
     return result;
 }
 
-void EvtProgram::add(int eventId, EvtInstruction ir) {
-    _eventsById[eventId].push_back(std::move(ir));
+void EvtFunction::compile() {
+    int size = instructions.size();
+
+    int maxStep = -1;
+    for (const EvtInstruction &ir : instructions)
+        maxStep = std::max(maxStep, ir.step);
+
+    indexByStep.assign(maxStep + 1, -1);
+    for (int i = size - 1; i >= 0; i--) // Iterating backwards so that the first instruction for each step wins.
+        if (instructions[i].step >= 0)
+            indexByStep[instructions[i].step] = i;
+
+    nextIndices.resize(size);
+    targetIndices.resize(size);
+    for (int i = 0; i < size; i++) {
+        nextIndices[i] = indexOf(instructions[i].step + 1);
+        targetIndices[i] = indexOf(instructions[i].target_step);
+    }
 }
 
 void EvtProgram::clear() {
     _eventsById.clear();
+    _triggersByOpcode.clear();
 }
 
 const EvtInstruction &EvtProgram::instruction(int eventId, int step) const {
-    for (const EvtInstruction &ir : function(eventId))
-        if (ir.step == step)
-            return ir;
-    throw Exception("Event {}:{} not found", eventId, step);
+    const EvtFunction &events = function(eventId);
+    int index = events.indexOf(step);
+    if (index == -1)
+        throw Exception("Event {}:{} not found", eventId, step);
+    return events.instructions[index];
 }
 
-const std::vector<EvtInstruction>& EvtProgram::function(int eventId) const {
+const EvtFunction &EvtProgram::function(int eventId) const {
     const auto *result = valuePtr(_eventsById, eventId);
     if (!result)
         throw Exception("Event {} not found", eventId);
     return *result;
 }
 
-std::vector<EventTrigger> EvtProgram::enumerateTriggers(EvtOpcode triggerType) {
-    std::vector<EventTrigger> result;
+const std::vector<EventTrigger> &EvtProgram::enumerateTriggers(EvtOpcode triggerType) const {
+    static const std::vector<EventTrigger> empty;
+
+    const auto *result = valuePtr(_triggersByOpcode, triggerType);
+    return result ? *result : empty;
+}
+
+void EvtProgram::rebuildTriggers() {
+    _triggersByOpcode.clear();
 
     for (const auto &[id, events] : _eventsById) {
-        for (const EvtInstruction &event : events) {
+        for (const EvtInstruction &event : events.instructions) {
             // As retarded as it might look, there are scripts that have THREE EVENT_OnLongTimer instructions.
             // Thus, we might have several event triggers for the same event id.
-            if (event.opcode == triggerType) {
-                EventTrigger trigger;
-                trigger.eventId = id;
-                trigger.eventStep = event.step;
-                result.push_back(trigger);
-            }
+            EventTrigger trigger;
+            trigger.eventId = id;
+            trigger.eventStep = event.step;
+            _triggersByOpcode[event.opcode].push_back(trigger);
         }
     }
 
-    // Need to sort the result so that the order doesn't depend on how the events were laid out in the hash map.
-    std::ranges::sort(result, std::less(), [] (const EventTrigger &value) { return std::tie(value.eventId, value.eventStep); }); // NOLINT
-    return result;
+    // Need to sort the triggers so that the order doesn't depend on how the events were laid out in the hash map.
+    for (auto &[_, triggers] : _triggersByOpcode)
+        std::ranges::sort(triggers, std::less(), [] (const EventTrigger &value) { return std::tie(value.eventId, value.eventStep); }); // NOLINT
 }
 
 bool EvtProgram::hasHint(int eventId) const {
     const auto* events = valuePtr(_eventsById, eventId);
-    if (!events || events->size() < 2)
+    if (!events || events->instructions.size() < 2)
         return false;
 
-    return (*events)[0].opcode == EVENT_MouseOver && (*events)[1].opcode == EVENT_Exit;
+    return events->instructions[0].opcode == EVENT_MouseOver && events->instructions[1].opcode == EVENT_Exit;
 }
 
 std::string EvtProgram::hint(int eventId) const {
@@ -97,7 +125,7 @@ std::string EvtProgram::hint(int eventId) const {
         return result;
     }
 
-    for (const EvtInstruction &ir : *events) {
+    for (const EvtInstruction &ir : events->instructions) {
         if (ir.opcode == EVENT_MouseOver) {
             mouseOverFound = true;
             if (ir.data.text_id < engine->_levelStrings.size()) {
@@ -119,7 +147,7 @@ void EvtProgram::dump(int eventId) const {
     const auto *events = valuePtr(_eventsById, eventId);
     if (events) {
         logger->trace("Event: {}", eventId);
-        for (const EvtInstruction &ir : *events) {
+        for (const EvtInstruction &ir : events->instructions) {
             logger->trace("{}", ir.toString());
         }
     } else {
@@ -13,11 +13,49 @@ struct EventTrigger {
     int eventStep;
 };
 
+/**
+ * Compiled event script.
+ *
+ * Instructions are stored in file order and are addressed by index. Steps & jump targets are resolved into indices
+ * when the script is compiled, so the interpreter never has to search for an instruction with a matching step.
+ *
+ * All index tables use `-1` for "no such instruction", which the interpreter treats as the end of the script.
+ */
+struct EvtFunction {
+    /**
+     * Rebuilds index tables. Must be called after `instructions` were changed.
+     */
+    void compile();
+
+    /**
+     * @param step                      Step in the script.
+     * @return                          Index of the first instruction with the given step, or `-1` if there is no
+     *                                  such instruction.
+     */
+    [[nodiscard]] int indexOf(int step) const {
+        if (step < 0 || static_cast<size_t>(step) >= indexByStep.size())
+            return -1;
+        return indexByStep[step];
+    }
+
+    std::vector<EvtInstruction> instructions;
+    std::vector<int> indexByStep; // Step -> index of the first instruction with that step.
+    std::vector<int> nextIndices; // Instruction index -> index of the instruction at `step + 1`.
+    std::vector<int> targetIndices; // Instruction index -> index of the instruction at `target_step`.
+};
+
 class EvtProgram {
  public:
+    /**
+     * Parses & compiles all event scripts in an .evt file. Each function is compiled only once, after all of its
+     * instructions were read.
+     *
+     * @param rawData                   Contents of an .evt file.
+     * @return                          Loaded program.
+     * @throws Exception                If the data is corrupted.
+     */
     static EvtProgram load(const Blob &rawData);
 
-    void add(int eventId, EvtInstruction ir);
     void clear();
 
     bool hasEvent(int eventId) const {
@@ -34,16 +72,17 @@ class EvtProgram {
 
     /**
      * @param eventId                   Event id.
-     * @return                          Reference to a list of events for the provided `eventId`.
+     * @return                          Reference to a compiled script for the provided `eventId`.
      * @throws Exception                If there are no events for the provided `eventId`.
      */
-    const std::vector<EvtInstruction>& function(int eventId) const;
+    const EvtFunction &function(int eventId) const;
 
     /**
      * @param triggerType               Event type to look for.
-     * @return                          List of all event positions that have the given event type.
+     * @return                          List of all event positions that have the given event type, sorted by event
+     *                                  id & step.
      */
-    std::vector<EventTrigger> enumerateTriggers(EvtOpcode triggerType);
+    const std::vector<EventTrigger> &enumerateTriggers(EvtOpcode triggerType) const;
 
     /**
      *
@@ -63,5 +102,9 @@ class EvtProgram {
     void dump(int eventId) const;
 
  private:
-    std::unordered_map<int, std::vector<EvtInstruction>> _eventsById;
+    void rebuildTriggers();
+
+ private:
+    std::unordered_map<int, EvtFunction> _eventsById;
+    std::unordered_map<EvtOpcode, std::vector<EventTrigger>> _triggersByOpcode;
 };
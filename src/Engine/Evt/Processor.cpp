@@ -11,6 +11,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/Evt/EvtProgram.h"
 #include "Engine/Evt/EvtInstruction.h"
 #include "Engine/Evt/EvtInterpreter.h"
@@ -57,8 +58,16 @@ void initDecorationEvents() {
 }
 
 void checkDecorationEvents() {
+    if (decorationsWithEvents.empty())
+        return;
+
+    proximityIndex.syncActors();
+    proximityIndex.syncSpriteObjects();
+
+    std::vector<int> nearObjects;
     for (int decorationId : decorationsWithEvents) {
         const LevelDecoration &decoration = pLevelDecorations[decorationId];
+        BBoxf triggerBox = BBoxf::cubic(decoration.vPosition, decoration.uTriggerRange);
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH) {
             if ((decoration.vPosition - pParty->pos).length() < decoration.uTriggerRange) {
@@ -67,7 +76,8 @@ void checkDecorationEvents() {
         }
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER) {
-            for (int i = 0; i < pActors.size(); i++) {
+            proximityIndex.actorsIn(triggerBox, &nearObjects);
+            for (int i : nearObjects) {
                 if ((decoration.vPosition - pActors[i].pos).length() < decoration.uTriggerRange) {
                     eventProcessor(decoration.uEventID, Pid(), 1);
                 }
@@ -75,7 +85,8 @@ void checkDecorationEvents() {
         }
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT) {
-            for (int i = 0; i < pSpriteObjects.size(); i++) {
+            proximityIndex.spriteObjectsIn(triggerBox, &nearObjects);
+            for (int i : nearObjects) {
                 if ((decoration.vPosition - pSpriteObjects[i].vPosition).length() < decoration.uTriggerRange) {
                     eventProcessor(decoration.uEventID, Pid(), 1);
                 }
@@ -85,16 +96,16 @@ void checkDecorationEvents() {
 }
 
 static void registerTimerTriggers(EvtOpcode triggerType, std::vector<MapTimer> *triggers) {
-    std::vector<EventTrigger> timerTriggers = engine->_localEventMap.enumerateTriggers(triggerType);
+    const std::vector<EventTrigger> &timerTriggers = engine->_localEventMap.enumerateTriggers(triggerType);
 
     // TODO(Nik-RE-dev): using time of last visit will help timers only slightly because each map leaving resets it.
     //                   To support fair timers they need to be saved directly.
     Time levelLastVisit = currentLocationTime().last_visit;
 
     triggers->clear();
-    for (EventTrigger &trigger : timerTriggers) {
+    for (const EventTrigger &trigger : timerTriggers) {
         MapTimer timer;
-        EvtInstruction ir = engine->_localEventMap.instruction(trigger.eventId, trigger.eventStep);
+        const EvtInstruction &ir = engine->_localEventMap.instruction(trigger.eventId, trigger.eventStep);
 
         if (ir.data.timer_descr.alt_halfmin_interval) {
             // Alternative interval is defined in terms of half-minutes
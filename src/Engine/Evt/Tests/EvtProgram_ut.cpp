@@ -0,0 +1,38 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Evt/EvtProgram.h"
+
+static EvtInstruction makeInstruction(EvtOpcode opcode, int step, int targetStep = -1) {
+    EvtInstruction result;
+    result.opcode = opcode;
+    result.step = step;
+    result.target_step = targetStep;
+    return result;
+}
+
+GAME_TEST(EvtProgram, CompileJumps) {
+    EvtFunction function;
+    function.instructions = {
+        makeInstruction(EVENT_Compare, 0, 3), // Forward jump.
+        makeInstruction(EVENT_ShowMessage, 1),
+        makeInstruction(EVENT_Jmp, 2, 7), // Jump to a missing step.
+        makeInstruction(EVENT_ShowMessage, 3),
+        makeInstruction(EVENT_Jmp, 4, 1), // Backward jump.
+        makeInstruction(EVENT_Exit, 4), // Duplicate step, unreachable.
+    };
+    function.compile();
+
+    EXPECT_EQ(function.targetIndices[0], 3);
+    EXPECT_EQ(function.targetIndices[2], -1);
+    EXPECT_EQ(function.targetIndices[4], 1);
+
+    // Steps resolve to the first instruction with that step.
+    EXPECT_EQ(function.indexOf(4), 4);
+    EXPECT_EQ(function.indexOf(5), -1);
+    EXPECT_EQ(function.indexOf(7), -1);
+    EXPECT_EQ(function.indexOf(-1), -1);
+
+    EXPECT_EQ(function.nextIndices, std::vector<int>({1, 2, 3, 4, -1, -1}));
+}
@@ -1,21 +1,82 @@
 #include "GameResourceManager.h"
 
+#include <random>
+#include <string>
+
 #include "Engine.h"
 #include "EngineFileSystem.h"
 
+#include "Library/Compression/Compression.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Exception.h"
+
+static constexpr std::string_view EVENTS_CACHE_PATH = "events.lod.cache";
+static constexpr size_t EVENTS_LOD_HEAD_SIZE = 64 * 1024;
 
 GameResourceManager::GameResourceManager() = default;
 GameResourceManager::~GameResourceManager() = default;
 
 void GameResourceManager::openGameResources() {
-    _eventsLodReader.open(dfs->read("data/events.lod"));
+    Blob eventsLod = dfs->read("data/events.lod");
+    _eventsLodReader.open(Blob::share(eventsLod));
     // TODO(captainurist):
     //  on exception:
     //      Error(localization->GetString(LSTR_MIGHT_AND_MAGIC_VII_IS_HAVING_TROUBLE), localization->GetString(LSTR_REINSTALL_NECESSARY));
     // but we can't use localization object here cause it's not yet initialized.
+
+    openEventsCache(eventsLod);
 }
 
 Blob GameResourceManager::getEventsFile(std::string_view filename) {
+    if (_eventsCacheReader.isOpen() && _eventsCacheReader.exists(filename))
+        return _eventsCacheReader.read(filename);
     return lod::decodeCompressed(_eventsLodReader.read(filename));
 }
+
+void GameResourceManager::openEventsCache(const Blob &eventsLod) {
+    // All tables are loaded from events.lod, and most of its entries are compressed. Decompressing them on every
+    // start is a noticeable chunk of startup time, so we keep the decompressed entries in a memory-mapped cache file
+    // in the cache folder. The cache is rebuilt when events.lod changes.
+    //
+    // Hashing all of events.lod on every start would eat into what the cache saves, so the cache is keyed by the size
+    // of events.lod & the checksum of its head, which holds the LOD directory with all entry offsets & sizes.
+    if (!cfs)
+        return;
+
+    uint64_t eventsLodSize = eventsLod.size();
+    uint32_t checksum = zlib::crc32(eventsLod.subBlob(0, EVENTS_LOD_HEAD_SIZE),
+                                    zlib::crc32(Blob::view(&eventsLodSize, sizeof(eventsLodSize))));
+
+    if (cfs->exists(EVENTS_CACHE_PATH)) {
+        try {
+            _eventsCacheReader.open(cfs->read(EVENTS_CACHE_PATH), checksum);
+            return;
+        } catch (const Exception &e) {
+            logger->info("Rebuilding events cache: {}", e.what());
+        }
+    }
+
+    LodCacheWriter writer;
+    for (const std::string &name : _eventsLodReader.ls()) {
+        try {
+            writer.write(name, lod::decodeCompressed(_eventsLodReader.read(name)));
+        } catch (const Exception &e) {
+            // Not cached, so the error will resurface in getEventsFile if someone actually needs this entry.
+            logger->warning("Could not decode '{}' for events cache: {}", name, e.what());
+        }
+    }
+    Blob cache = writer.finish(checksum);
+
+    // Several processes might be starting up at the same time, so write into a temporary file & then rename.
+    std::string tmpPath = fmt::format("{}.{:08x}", EVENTS_CACHE_PATH, std::random_device()());
+    try {
+        cfs->write(tmpPath, cache);
+        cfs->rename(tmpPath, EVENTS_CACHE_PATH);
+    } catch (const std::exception &e) {
+        logger->warning("Could not write events cache: {}", e.what());
+    }
+
+    _eventsCacheReader.open(std::move(cache), checksum);
+}
@@ -4,6 +4,7 @@
 
 #include "Utility/Memory/Blob.h"
 
+#include "Library/Lod/LodCache.h"
 #include "Library/Lod/LodReader.h"
 
 class GameResourceManager {
@@ -15,6 +16,10 @@ class GameResourceManager {
 
     Blob getEventsFile(std::string_view filename);
 
+ private:
+    void openEventsCache(const Blob &eventsLod);
+
  private:
     LodReader _eventsLodReader;
+    LodCacheReader _eventsCacheReader;
 };
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "Engine/Evt/Processor.h"
 #include "Engine/Objects/DecorationList.h"
@@ -11,6 +12,7 @@
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/TurnEngine/TurnEngine.h"
 #include "Engine/OurMath.h"
@@ -457,31 +459,34 @@ void CollideIndoorWithGeometry(bool ignore_ethereal) {
 }
 
 void CollideOutdoorWithModels(bool ignore_ethereal) {
-    for (BSPModel &model : pOutdoor->pBModels) {
+    static std::vector<OutdoorFaceRef> faces; // Static so that we don't reallocate on every call.
+    pOutdoor->faceGrid.facesIn(collision_state.bbox, &faces);
+
+    for (OutdoorFaceRef ref : faces) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
         if (!collision_state.bbox.intersects(model.pBoundingBox))
             continue;
 
-        for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+        ODMFace &mface = model.pFaces[ref.faceId];
+        if (!collision_state.bbox.intersects(mface.pBoundingBox))
+            continue;
 
-            // TODO: we should really either merge two face classes, or template the functions down the chain call here.
-            BLVFace face;
-            face.facePlane = mface.facePlane;
-            face.uAttributes = mface.uAttributes;
-            face.pBounding = mface.pBoundingBox;
-            face.zCalc = mface.zCalc;
-            face.uPolygonType = mface.uPolygonType;
-            face.uNumVertices = mface.uNumVertices;
-            face.resource = mface.resource;
-            face.pVertexIDs = mface.pVertexIDs.data();
-
-            if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
-                continue;
+        // TODO: we should really either merge two face classes, or template the functions down the chain call here.
+        BLVFace face;
+        face.facePlane = mface.facePlane;
+        face.uAttributes = mface.uAttributes;
+        face.pBounding = mface.pBoundingBox;
+        face.zCalc = mface.zCalc;
+        face.uPolygonType = mface.uPolygonType;
+        face.uNumVertices = mface.uNumVertices;
+        face.resource = mface.resource;
+        face.pVertexIDs = mface.pVertexIDs.data();
+
+        if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
+            continue;
 
-            Pid pid = Pid::odmFace(model.index, mface.index);
-            CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
-        }
+        Pid pid = Pid::odmFace(model.index, mface.index);
+        CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
     }
 }
 
@@ -561,7 +566,10 @@ bool CollideWithActor(int actor_idx, int override_radius) {
 }
 
 void _46ED8A_collide_against_sprite_objects(Pid pid) {
-    for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
+    static std::vector<int> nearObjects; // Static so that we don't reallocate on every call.
+    proximityIndex.spriteObjectsIn(collision_state.bbox, &nearObjects);
+
+    for (int i : nearObjects) {
         if (pSpriteObjects[i].uObjectDescID == 0)
             continue;
 
@@ -889,6 +897,9 @@ void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
 void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *faceId, int *faceEvent) {
     constexpr float closestdist = 0.5f; // Closest allowed approach to collision surface - needs adjusting
 
+    static std::vector<int> nearActors; // Static so that we don't reallocate on every call.
+    proximityIndex.syncActors();
+
     collision_state.total_move_distance = 0;
     collision_state.radius_lo = pParty->radius;
     collision_state.radius_hi = pParty->radius;
@@ -913,7 +924,8 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
             //                     See ProcessPartyCollisionsODM.
             // pskelton - probably because there are no/ very few sprite objects in BLV. The only ones i can think of are the trees in the fairy hill.
             if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-                for (int k = 0; k < pActors.size(); ++k)
+                proximityIndex.actorsIn(collision_state.bbox, &nearActors);
+                for (int k : nearActors)
                     CollideWithActor(k, 0);
             }
             if (CollideIndoorWithPortals())
@@ -1046,6 +1058,10 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
 void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, int *floorFaceId, bool *partyNotOnModel, bool *partyHasHitModel, int *triggerID) {
     constexpr float closestdist = 0.5f;  // Closest allowed approach to collision surface - needs adjusting
 
+    static std::vector<int> nearActors; // Static so that we don't reallocate on every call.
+    proximityIndex.syncActors();
+    proximityIndex.syncSpriteObjects();
+
     // --(Collisions)-------------------------------------------------------------------
     collision_state.total_move_distance = 0;
     collision_state.radius_lo = pParty->radius;
@@ -1070,7 +1086,8 @@ void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, int *
         CollideOutdoorWithDecorations(worldToGrid(pParty->pos));
         _46ED8A_collide_against_sprite_objects(Pid::character(0));
         if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-            for (size_t actor_id = 0; actor_id < pActors.size(); ++actor_id)
+            proximityIndex.actorsIn(collision_state.bbox, &nearActors);
+            for (int actor_id : nearActors)
                 CollideWithActor(actor_id, 0);
         }
 
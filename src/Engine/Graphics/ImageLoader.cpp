@@ -16,6 +16,7 @@
 #include "Library/Image/ImageFunctions.h"
 #include "Library/Image/Pcx.h"
 #include "Library/Image/Png.h"
+#include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodImage.h"
 #include "Library/LodFormats/LodSprite.h"
 #include "Library/Logger/Logger.h"
@@ -54,7 +55,7 @@ static Palette MakePaletteColorKey(const Palette &palette, Color key) {
 }
 
 bool Paletted_Img_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    LodImage *tex = lod->loadTexture(resource_name);
+    const LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
         return false;
 
@@ -67,7 +68,7 @@ bool Paletted_Img_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImag
 }
 
 bool ColorKey_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    LodImage *tex = lod->loadTexture(resource_name);
+    const LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
         return false;
 
@@ -86,7 +87,7 @@ bool ColorKey_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImag
 }
 
 bool Image16bit_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    LodImage *tex = lod->loadTexture(resource_name);
+    const LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
         return false;
 
@@ -105,7 +106,7 @@ bool Image16bit_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedIm
 }
 
 bool Alpha_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    LodImage *tex = lod->loadTexture(resource_name);
+    const LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
         return false;
 
@@ -133,13 +134,14 @@ bool PCX_LOD_Raw_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
 }
 
 bool PCX_LOD_Compressed_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    Blob pcx_data = blob_func();
-    if (!pcx_data) {
+    std::shared_ptr<const RgbaImage> image = lod->loadPcx(resource_name);
+    if (!image) {
         logger->warning("Unable to load {}", resource_name);
         return false;
     }
 
-    return InternalLoad(pcx_data, rgbaImage);
+    *rgbaImage = RgbaImage::copy(*image);
+    return true;
 }
 
 static Color ProcessTransparentPixel(const GrayscaleImage &image, const Palette &palette, size_t x, size_t y) {
@@ -188,7 +190,7 @@ static Color ProcessTransparentPixel(const GrayscaleImage &image, const Palette
 }
 
 bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    LodImage *tex = lod->loadTexture(this->resource_name);
+    const LodImage *tex = lod->loadTexture(this->resource_name);
 
     size_t w = tex->image.width();
     size_t h = tex->image.height();
@@ -196,14 +198,14 @@ bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
     // TODO(captainurist): no need to copy here.
     *indexedImage = GrayscaleImage::copy(tex->image.width(), tex->image.height(), tex->image.pixels().data()); // NOLINT: this is not std::copy.
 
-    // Desaturate bitmaps
-    tex->palette = PaletteManager::createLoadedPalette(tex->palette);
+    // Desaturate bitmaps. Note that decoded textures are shared, so we shouldn't modify the original palette.
+    Palette loadedPalette = PaletteManager::createLoadedPalette(tex->palette);
 
     if (!transparentTextures.contains(this->resource_name)) {
-        *palette = tex->palette;
+        *palette = loadedPalette;
         *rgbaImage = makeRgbaImage(*indexedImage, *palette);
     } else {
-        *palette = MakePaletteAlpha(tex->palette);
+        *palette = MakePaletteAlpha(loadedPalette);
 
         *rgbaImage = RgbaImage::uninitialized(w, h);
         for (size_t y = 0; y < h; y++) {
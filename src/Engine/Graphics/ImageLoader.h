@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <functional>
 
 #include "Library/Color/Color.h"
 #include "Library/Image/Image.h"
@@ -96,19 +95,15 @@ class PCX_LOD_Raw_Loader : public PCX_Loader {
 
 class PCX_LOD_Compressed_Loader : public PCX_Loader {
  public:
-    // TODO(captainurist): this is the next level of ugly, redo.
-    template<class Lod>
-    inline PCX_LOD_Compressed_Loader(Lod *lod, std::string_view filename) {
-        resource_name = filename;
-        blob_func = [this, lod] {
-            return lod->LoadCompressedTexture(resource_name);
-        };
+    inline PCX_LOD_Compressed_Loader(LodTextureCache *lod, std::string_view filename) {
+        this->resource_name = filename;
+        this->lod = lod;
     }
 
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
-    std::function<Blob()> blob_func;
+    LodTextureCache *lod;
 };
 
 class Bitmaps_LOD_Loader : public ImageLoader {
@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -27,6 +29,7 @@
 #include "Engine/Random/Random.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Tables/ItemTable.h"
 #include "Engine/OurMath.h"
@@ -38,6 +41,8 @@
 #include "Engine/Localization.h"
 #include "Engine/MapInfo.h"
 #include "Engine/LOD.h"
+#include "Engine/LocationPrefetch.h"
+#include "Engine/SaveLoad.h"
 
 #include "GUI/GUIProgressBar.h"
 #include "GUI/GUIWindow.h"
@@ -142,7 +147,7 @@ void PrepareDrawLists_BLV() {
     pBLVRenderParams->Reset();
     uNumDecorationsDrawnThisFrame = 0;
     uNumSpritesDrawnThisFrame = 0;
-    uNumBillboardsToDraw = 0;
+    pBillboardRenderList.clear();
 
     pMobileLightsStack->uNumLightsActive = 0;
     //pStationaryLightsStack->uNumLightsActive = 0;
@@ -167,13 +172,7 @@ void PrepareDrawLists_BLV() {
 
 //----- (004407D9) --------------------------------------------------------
 void BLVRenderParams::Reset() {
-    this->uPartySectorID = pIndoor->GetSector(pParty->pos);
-    this->uPartyEyeSectorID = pIndoor->GetSector(pParty->pos + Vec3f(0, 0, pParty->eyeLevel));
-
-    if (!this->uPartySectorID) {
-        assert(false);  // shouldnt happen, please provide savegame
-    }
-
+    updatePartySectors();
 
     {
         this->uViewportX = pViewport->viewportTL_X;
@@ -192,6 +191,15 @@ void BLVRenderParams::Reset() {
     this->uNumFacesRenderedThisFrame = 0;
 }
 
+void BLVRenderParams::updatePartySectors() {
+    this->uPartySectorID = pIndoor->GetSector(pParty->pos);
+    this->uPartyEyeSectorID = pIndoor->GetSector(pParty->pos + Vec3f(0, 0, pParty->eyeLevel));
+
+    if (!this->uPartySectorID) {
+        assert(false);  // shouldnt happen, please provide savegame
+    }
+}
+
 
 //----- (00440B44) --------------------------------------------------------
 void IndoorLocation::DrawIndoorFaces(bool bD3D) {
@@ -258,6 +266,8 @@ void IndoorLocation::Release() {
     this->pLFaces.clear();
     this->pSpawnPoints.clear();
     this->pSectors.clear();
+    this->sectorGrid.clear();
+    this->sectorVisibility.clear();
     this->pFaces.clear();
     this->pFaceExtras.clear();
     this->pVertices.clear();
@@ -297,15 +307,18 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     bLoaded = true;
 
     IndoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
+    if (!TakePrefetchedLocation(blv_filename, &location))
+        deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
     reconstruct(location, this);
+    sectorGrid.build(pSectors);
+    sectorVisibility.build(pSectors, pFaces);
 
     std::string dlv_filename = fmt::format("{}.dlv", filename.substr(0, filename.size() - 4));
 
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     IndoorDelta_MM7 delta;
-    if (Blob blob = lod::decodeCompressed(pSave_LOD->read(dlv_filename))) {
+    if (Blob blob = ReadLocationDelta(dlv_filename)) {
         try {
             deserialize(blob, &delta, tags::context(location));
 
@@ -370,8 +383,8 @@ int IndoorLocation::GetSector(float sX, float sY, float sZ) {
     std::optional<int> foundSector;
     bool singleSectorFound = false;
 
-    // loop through sectors
-    for (unsigned i = 1; i < pSectors.size(); ++i) {
+    // loop through sectors that might contain the point
+    for (int i : sectorGrid.sectorsAt(sX, sY)) {
         if (NumFoundFaceStore >= 5) break;
 
         BLVSector *pSector = &pSectors[i];
@@ -407,7 +420,7 @@ int IndoorLocation::GetSector(float sX, float sY, float sZ) {
                 continue;
 
             // add found faces into store
-            if (pFace->Contains(Vec3f(sX, sY, 0), MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+            if (pFace->Contains(Vec3f(sX, sY, 0), MODEL_INDOOR, engine->config->hot.floorChecksEps, FACE_XY_PLANE))
                 FoundFaceStore[NumFoundFaceStore++] = uFaceID;
             if (NumFoundFaceStore >= 5)
                 break; // TODO(captainurist): we do get here sometimes (e.g. in dragon cave), increase limit?
@@ -729,6 +742,12 @@ void BLV_UpdateDoors() {
 }
 
 void BLV_UpdateDoorGeometry(BLVDoor* door, int distance) {
+    // Door faces can be portals, so cached portal walks are no longer valid.
+    pIndoor->sectorVisibility.invalidateDetections();
+
+    // Door faces are moved in place, renderer needs to rebuild their cached vertices.
+    render->invalidateIndoorFaceGeometry(std::span(door->pFaceIDs, door->uNumFaces));
+
     // adjust verts to how open the door is
     for (int j = 0; j < door->uNumVertices; ++j) {
         pIndoor->pVertices[door->pVertexIDs[j]].x = door->vDirection.x * distance + door->pXOffsets[j];
@@ -838,9 +857,11 @@ void switchDoorAnimation(unsigned int uDoorID, DoorAction action) {
 
 //----- (0046F90C) --------------------------------------------------------
 void UpdateActors_BLV() {
-    if (engine->config->debug.NoActors.value())
+    if (engine->config->hot.noActors)
         return;
 
+    proximityIndex.syncSpriteObjects();
+
     for (Actor &actor : pActors) {
         if (actor.aiState == Removed || actor.aiState == Disabled || actor.aiState == Summoned || actor.moveSpeed == 0)
             continue;
@@ -868,7 +889,7 @@ void UpdateActors_BLV() {
             if (actor.aiState == Dead || actor.aiState == Dying) {
                 if (actor.pos.z < floorZ + 30) { // 30 to provide small error / rounding factor
                     if (pMonsterStats->infos[actor.monsterInfo.id].bloodSplatOnDeath) {
-                        if (engine->config->graphics.BloodSplats.value()) {
+                        if (engine->config->hot.bloodSplats) {
                             float splatRadius = actor.radius * engine->config->graphics.BloodSplatsMultiplier.value();
                             EngineIocContainer::ResolveDecalBuilder()->AddBloodsplat(Vec3f(actor.pos.x, actor.pos.y, floorZ + 30), colorTable.Red, splatRadius);
                         }
@@ -1128,6 +1149,7 @@ float BLV_GetFloorLevel(const Vec3f &pos, int uSectorID, int *pFaceID) {
     int blv_floor_id[5] = { 0 };
 
     BLVSector *pSector = &pIndoor->pSectors[uSectorID];
+    int slack = engine->config->hot.floorChecksEps;
 
     // loop over all floor faces
     for (unsigned i = 0; i < pSector->uNumFloors; ++i) {
@@ -1138,7 +1160,7 @@ float BLV_GetFloorLevel(const Vec3f &pos, int uSectorID, int *pFaceID) {
         if (pFloor->Ethereal())
             continue;
 
-        if (!pFloor->Contains(pos, MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+        if (!pFloor->Contains(pos, MODEL_INDOOR, slack, FACE_XY_PLANE))
             continue;
 
         // TODO: Does POLYGON_Ceiling really belong here?
@@ -1169,7 +1191,7 @@ float BLV_GetFloorLevel(const Vec3f &pos, int uSectorID, int *pFaceID) {
             if (portal->uPolygonType != POLYGON_Floor)
                 continue;
 
-            if(!portal->Contains(pos, MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+            if(!portal->Contains(pos, MODEL_INDOOR, slack, FACE_XY_PLANE))
                 continue;
 
             blv_floor_z[FacesFound] = -29000;
@@ -1294,42 +1316,31 @@ void IndoorLocation::PrepareDecorationsRenderList_BLV(unsigned int uDecorationID
             if (projected_x + screen_space_half_width >= (signed int)pViewport->viewportTL_X &&
                 projected_x - screen_space_half_width <= (signed int)pViewport->viewportBR_X) {
                 if (projected_y >= pViewport->viewportTL_Y && (projected_y - screen_space_height) <= pViewport->viewportBR_Y) {
-                    assert(uNumBillboardsToDraw < 500);
-                    ++uNumBillboardsToDraw;
                     ++uNumDecorationsDrawnThisFrame;
 
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].hwsprite =
-                        v11->hw_sprites[v9];
+                    RenderBillboard &billboard = pBillboardRenderList.emplace_back();
+                    billboard.hwsprite = v11->hw_sprites[v9];
 
                     if (v11->hw_sprites[v9]->texture->height() == 0 || v11->hw_sprites[v9]->texture->width() == 0)
                         assert(false);
 
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].uPaletteIndex = v11->GetPaletteIndex();
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].uIndoorSectorID =
-                        uSectorID;
-
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].fov_x =
-                        pCamera3D->ViewPlaneDistPixels;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_x = billb_scale;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_y = billb_scale;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].field_1E = v30;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].world_x =
-                        pLevelDecorations[uDecorationID].vPosition.x;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].world_y =
-                        pLevelDecorations[uDecorationID].vPosition.y;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].world_z =
-                        pLevelDecorations[uDecorationID].vPosition.z;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_x =
-                        projected_x;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_y =
-                        projected_y;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_z =
-                        view_x;
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].object_pid =
-                        Pid(OBJECT_Decoration, uDecorationID);
-
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].sTintColor = Color();
-                    pBillboardRenderList[uNumBillboardsToDraw - 1].pSpriteFrame = v11;
+                    billboard.uPaletteIndex = v11->GetPaletteIndex();
+                    billboard.uIndoorSectorID = uSectorID;
+
+                    billboard.fov_x = pCamera3D->ViewPlaneDistPixels;
+                    billboard.screenspace_projection_factor_x = billb_scale;
+                    billboard.screenspace_projection_factor_y = billb_scale;
+                    billboard.field_1E = v30;
+                    billboard.world_x = pLevelDecorations[uDecorationID].vPosition.x;
+                    billboard.world_y = pLevelDecorations[uDecorationID].vPosition.y;
+                    billboard.world_z = pLevelDecorations[uDecorationID].vPosition.z;
+                    billboard.screen_space_x = projected_x;
+                    billboard.screen_space_y = projected_y;
+                    billboard.screen_space_z = view_x;
+                    billboard.object_pid = Pid(OBJECT_Decoration, uDecorationID);
+
+                    billboard.sTintColor = Color();
+                    billboard.pSpriteFrame = v11;
                 }
             }
         }
@@ -1449,45 +1460,56 @@ bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from
 
     BBoxf bbox = BBoxf::forPoints(from, target);
 
-    for (BSPModel &model : pOutdoor->pBModels) {
-        if (CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128) {
-            for (ODMFace &face : model.pFaces) {
-                if (face.Ethereal()) continue;
+    static std::vector<OutdoorFaceRef> faces; // Static so that we don't reallocate on every call.
+    pOutdoor->faceGrid.facesAlong(target, from, &faces);
+
+    int lastModelId = -1;
+    bool modelNearLine = false;
+    for (OutdoorFaceRef ref : faces) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
+        if (lastModelId != ref.modelId) {
+            lastModelId = ref.modelId;
+            modelNearLine = CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <=
+                            model.sBoundingRadius + 128;
+        }
+        if (!modelNearLine)
+            continue;
 
-                float dirDotNormal = dot(dir, face.facePlane.normal);
-                bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
-                if (FaceIsParallel)
-                    continue;
+        ODMFace &face = model.pFaces[ref.faceId];
+        if (face.Ethereal()) continue;
 
-                // bounds check
-                if (!bbox.intersects(face.pBoundingBox))
-                    continue;
+        float dirDotNormal = dot(dir, face.facePlane.normal);
+        bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
+        if (FaceIsParallel)
+            continue;
 
-                // point target plane distacne
-                float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target);
+        // bounds check
+        if (!bbox.intersects(face.pBoundingBox))
+            continue;
 
-                // are we on same side of plane
-                if (dirDotNormal <= 0) {
-                    // angle obtuse - is target underneath plane
-                    if (NegFacePlaceDist > 0)
-                        continue;  // can never hit
-                } else {
-                    // angle acute - is target above plane
-                    if (NegFacePlaceDist < 0)
-                        continue;  // can never hit
-                }
+        // point target plane distacne
+        float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target);
 
-                if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
-                    // calc how far along line interesction is
-                    float IntersectionDist = NegFacePlaceDist /  dirDotNormal;
-                    // less than zero means intersection is behind target point
-                    // greater than dist means intersection is behind the caster
-                    if (IntersectionDist >= 0.0 && IntersectionDist <= dist) {
-                        Vec3f pos = target + IntersectionDist * dir;
-                        if (face.Contains(pos, model.index)) {
-                            return true;
-                        }
-                    }
+        // are we on same side of plane
+        if (dirDotNormal <= 0) {
+            // angle obtuse - is target underneath plane
+            if (NegFacePlaceDist > 0)
+                continue;  // can never hit
+        } else {
+            // angle acute - is target above plane
+            if (NegFacePlaceDist < 0)
+                continue;  // can never hit
+        }
+
+        if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
+            // calc how far along line interesction is
+            float IntersectionDist = NegFacePlaceDist /  dirDotNormal;
+            // less than zero means intersection is behind target point
+            // greater than dist means intersection is behind the caster
+            if (IntersectionDist >= 0.0 && IntersectionDist <= dist) {
+                Vec3f pos = target + IntersectionDist * dir;
+                if (face.Contains(pos, model.index)) {
+                    return true;
                 }
             }
         }
@@ -2057,7 +2079,7 @@ void SpawnRandomTreasure(MapInfo *mapInfo, SpawnPoint *a2) {
 
 //----- (0043F515) --------------------------------------------------------
 void FindBillboardsLightLevels_BLV() {
-    for (unsigned i = 0; i < uNumBillboardsToDraw; ++i) {
+    for (unsigned i = 0; i < pBillboardRenderList.size(); ++i) {
         if (pBillboardRenderList[i].field_1E & 2 ||
             uCurrentlyLoadedLevelType == LEVEL_INDOOR &&
                 !pBillboardRenderList[i].uIndoorSectorID)
@@ -14,6 +14,8 @@
 #include "LocationTime.h"
 #include "LocationFunctions.h"
 #include "FaceEnums.h"
+#include "IndoorSectorGrid.h"
+#include "IndoorSectorVisibility.h"
 
 struct BspRenderer;
 struct IndoorLocation;
@@ -230,6 +232,8 @@ struct IndoorLocation {
     std::vector<BLVFace> pFaces;
     std::vector<BLVFaceExtra> pFaceExtras;
     std::vector<BLVSector> pSectors;
+    IndoorSectorGrid sectorGrid; // Point location index for `pSectors`, rebuilt on load.
+    IndoorSectorVisibility sectorVisibility; // Portal graph visibility for `pSectors`, rebuilt on load.
     std::vector<BLVLight> pLights;
     std::vector<BLVDoor> pDoors;
     std::vector<BSPNode> pNodes;
@@ -261,6 +265,12 @@ struct BLVRenderParams {
 
     void Reset();
 
+    /**
+     * Recalculates party sectors from the current party position. These are used by the game logic (actor line of
+     * sight, dropped items), so this has to be called on frames that are not drawn too.
+     */
+    void updatePartySectors();
+
     // TODO(pskelton): move to party?
     int uPartySectorID = 0;
     int uPartyEyeSectorID = 0;
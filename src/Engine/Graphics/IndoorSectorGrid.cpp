@@ -0,0 +1,51 @@
+#include "IndoorSectorGrid.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Indoor.h"
+
+void IndoorSectorGrid::build(const std::vector<BLVSector> &sectors) {
+    clear();
+
+    auto forEachCell = [](const BBoxf &bbox, auto &&callback) {
+        int x1 = cellCoord(bbox.x1 - SECTOR_PADDING), x2 = cellCoord(bbox.x2 + SECTOR_PADDING);
+        int y1 = cellCoord(bbox.y1 - SECTOR_PADDING), y2 = cellCoord(bbox.y2 + SECTOR_PADDING);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                callback(y * GRID_SIZE + x);
+    };
+
+    // Sector zero is a dummy sector, so we skip it.
+    std::vector<int> counts(GRID_SIZE * GRID_SIZE + 1, 0);
+    for (size_t i = 1; i < sectors.size(); i++)
+        forEachCell(sectors[i].pBounding, [&](int cell) { counts[cell + 1]++; });
+
+    _cellOffsets.resize(GRID_SIZE * GRID_SIZE + 1);
+    _cellOffsets[0] = 0;
+    for (int i = 1; i <= GRID_SIZE * GRID_SIZE; i++)
+        _cellOffsets[i] = _cellOffsets[i - 1] + counts[i];
+
+    _sectors.resize(_cellOffsets.back());
+    std::vector<int> positions(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    for (size_t i = 1; i < sectors.size(); i++)
+        forEachCell(sectors[i].pBounding, [&](int cell) { _sectors[positions[cell]++] = i; });
+}
+
+void IndoorSectorGrid::clear() {
+    _cellOffsets.clear();
+    _sectors.clear();
+}
+
+std::span<const int> IndoorSectorGrid::sectorsAt(float x, float y) const {
+    if (_sectors.empty())
+        return {};
+
+    int index = cellCoord(y) * GRID_SIZE + cellCoord(x);
+    return std::span<const int>(_sectors.data() + _cellOffsets[index], _sectors.data() + _cellOffsets[index + 1]);
+}
+
+int IndoorSectorGrid::cellCoord(float worldCoord) {
+    float cell = std::floor((worldCoord + GRID_SIZE * CELL_SIZE / 2) / CELL_SIZE);
+    return static_cast<int>(std::clamp(cell, 0.0f, static_cast<float>(GRID_SIZE - 1)));
+}
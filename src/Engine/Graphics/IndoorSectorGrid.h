@@ -0,0 +1,40 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+struct BLVSector;
+
+/**
+ * Point location index for indoor sectors.
+ *
+ * This is a uniform 2D grid with each cell storing ids of all sectors whose bounding boxes (padded by
+ * `SECTOR_PADDING` in the XY plane) overlap the cell. Coordinates outside the grid are clamped to the border cells.
+ *
+ * Sector lists are sorted by sector id, so iterating over them visits sectors in the same order as iterating over
+ * `IndoorLocation::pSectors` does, just with the sectors that can't contain the point skipped.
+ */
+class IndoorSectorGrid {
+ public:
+    static constexpr int GRID_SIZE = 128;
+    static constexpr int CELL_SIZE = 512;
+    static constexpr float SECTOR_PADDING = 6; // `IndoorLocation::GetSector` checks sector bounds padded by 5.
+
+    void build(const std::vector<BLVSector> &sectors);
+    void clear();
+
+    /**
+     * @param x                         World X coordinate.
+     * @param y                         World Y coordinate.
+     * @return                          Ids of all sectors whose padded bounding rect might contain the given point.
+     *                                  Sector zero is never returned.
+     */
+    [[nodiscard]] std::span<const int> sectorsAt(float x, float y) const;
+
+ private:
+    [[nodiscard]] static int cellCoord(float worldCoord);
+
+ private:
+    std::vector<int> _cellOffsets; // Offsets into `_sectors`, `GRID_SIZE * GRID_SIZE + 1` elements.
+    std::vector<int> _sectors;
+};
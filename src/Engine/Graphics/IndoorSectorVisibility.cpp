@@ -0,0 +1,92 @@
+#include "IndoorSectorVisibility.h"
+
+#include "Indoor.h"
+
+// Cached detections are only reused for objects that didn't move, so there is not much point in keeping the cache
+// around once it grows large.
+static constexpr size_t MAX_CACHED_DETECTIONS = 4096;
+
+void IndoorSectorVisibility::build(const std::vector<BLVSector> &sectors, const std::vector<BLVFace> &faces) {
+    clear();
+
+    _sectorCount = sectors.size();
+    _rowWords = (_sectorCount + 63) / 64;
+    _table.assign(static_cast<size_t>(_sectorCount) * _rowWords, 0);
+
+    // Portal graph edges, built using the same next sector logic as the portal walk in `Detect_Between_Objects`.
+    std::vector<std::vector<int>> edges(_sectorCount);
+    for (int i = 0; i < _sectorCount; i++) {
+        const BLVSector &sector = sectors[i];
+        for (int j = 0; j < sector.uNumPortals; j++) {
+            const BLVFace &portal = faces[sector.pPortals[j]];
+            int next = portal.uSectorID == i ? portal.uBackSectorID : portal.uSectorID;
+            if (next != i && next >= 0 && next < _sectorCount)
+                edges[i].push_back(next);
+        }
+    }
+
+    // Depth-limited BFS from each sector.
+    std::vector<int> depths;
+    std::vector<int> queue;
+    for (int from = 0; from < _sectorCount; from++) {
+        uint64_t *row = &_table[static_cast<size_t>(from) * _rowWords];
+
+        depths.assign(_sectorCount, -1);
+        queue.clear();
+        depths[from] = 0;
+        queue.push_back(from);
+        for (size_t head = 0; head < queue.size(); head++) {
+            int sector = queue[head];
+            if (depths[sector] == MAX_PORTAL_HOPS)
+                continue;
+
+            for (int next : edges[sector]) {
+                if (depths[next] != -1)
+                    continue;
+                depths[next] = depths[sector] + 1;
+                row[next / 64] |= uint64_t(1) << (next % 64);
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+void IndoorSectorVisibility::clear() {
+    _sectorCount = 0;
+    _rowWords = 0;
+    _table.clear();
+    _detections.clear();
+}
+
+bool IndoorSectorVisibility::mightSee(int fromSector, int toSector) const {
+    if (fromSector < 0 || fromSector >= _sectorCount || toSector < 0 || toSector >= _sectorCount)
+        return true;
+
+    return (_table[static_cast<size_t>(fromSector) * _rowWords + toSector / 64] >> (toSector % 64)) & 1;
+}
+
+std::optional<bool> IndoorSectorVisibility::cachedDetection(Pid from, Pid to, const Vec3f &fromPos, int fromSector,
+                                                            const Vec3f &toPos, int toSector) const {
+    auto pos = _detections.find(detectionKey(from, to));
+    if (pos == _detections.end())
+        return std::nullopt;
+
+    const Detection &detection = pos->second;
+    if (detection.fromPos != fromPos || detection.toPos != toPos ||
+        detection.fromSector != fromSector || detection.toSector != toSector)
+        return std::nullopt;
+
+    return detection.result;
+}
+
+void IndoorSectorVisibility::cacheDetection(Pid from, Pid to, const Vec3f &fromPos, int fromSector,
+                                            const Vec3f &toPos, int toSector, bool result) {
+    if (_detections.size() >= MAX_CACHED_DETECTIONS)
+        _detections.clear();
+
+    _detections[detectionKey(from, to)] = {fromPos, toPos, fromSector, toSector, result};
+}
+
+void IndoorSectorVisibility::invalidateDetections() {
+    _detections.clear();
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Pid.h"
+
+#include "Library/Geometry/Vec.h"
+
+struct BLVSector;
+struct BLVFace;
+
+/**
+ * Sector-to-sector potential visibility table for indoor locations, and a result cache for
+ * `Detect_Between_Objects`.
+ *
+ * `Detect_Between_Objects` walks the portal graph along the ray between the two objects, and gives up after
+ * `MAX_PORTAL_HOPS` portal crossings. The table stores, for each pair of sectors, whether the target sector is
+ * reachable from the source sector in at most that many crossings, following the portals in exactly the same way the
+ * walk does. If it's not, no ray can get there and the pair can be rejected without touching the geometry.
+ *
+ * The result cache stores the outcome of the last portal walk for each pair of objects together with the inputs it
+ * was computed from, so that repeated checks for objects that didn't move are free. Portal geometry can change when
+ * doors move, so the cache must be invalidated whenever that happens.
+ */
+class IndoorSectorVisibility {
+ public:
+    static constexpr int MAX_PORTAL_HOPS = 30;
+
+    void build(const std::vector<BLVSector> &sectors, const std::vector<BLVFace> &faces);
+    void clear();
+
+    /**
+     * @param fromSector                Sector id to look from.
+     * @param toSector                  Sector id to look into.
+     * @return                          Whether a portal walk starting in `fromSector` can ever reach `toSector`.
+     *                                  Returns `true` for sector ids that are not in the table.
+     */
+    [[nodiscard]] bool mightSee(int fromSector, int toSector) const;
+
+    /**
+     * @return                          Cached portal walk result for the given objects, or `std::nullopt` if there
+     *                                  is no cached result or it was computed for different inputs.
+     */
+    [[nodiscard]] std::optional<bool> cachedDetection(Pid from, Pid to, const Vec3f &fromPos, int fromSector,
+                                                      const Vec3f &toPos, int toSector) const;
+
+    void cacheDetection(Pid from, Pid to, const Vec3f &fromPos, int fromSector, const Vec3f &toPos, int toSector,
+                        bool result);
+
+    /**
+     * Drops all cached portal walk results. Should be called whenever portal geometry changes.
+     */
+    void invalidateDetections();
+
+ private:
+    struct Detection {
+        Vec3f fromPos;
+        Vec3f toPos;
+        int fromSector = 0;
+        int toSector = 0;
+        bool result = false;
+    };
+
+    [[nodiscard]] static uint32_t detectionKey(Pid from, Pid to) {
+        return (static_cast<uint32_t>(from.packed()) << 16) | to.packed();
+    }
+
+ private:
+    int _sectorCount = 0;
+    int _rowWords = 0; // Number of 64-bit words per table row.
+    std::vector<uint64_t> _table; // `_sectorCount` rows, bit `to` in row `from` is set if `to` is reachable.
+    std::unordered_map<uint32_t, Detection> _detections;
+};
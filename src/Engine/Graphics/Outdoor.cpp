@@ -26,6 +26,7 @@
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
 #include "Engine/Snapshots/CompositeSnapshots.h"
@@ -38,6 +39,8 @@
 #include "Engine/Graphics/BspRenderer.h"
 #include "Engine/MapInfo.h"
 #include "Engine/LOD.h"
+#include "Engine/LocationPrefetch.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Seasons.h"
 #include "Engine/Data/TileEnumFunctions.h"
 
@@ -65,6 +68,9 @@ ODMRenderParams *pODMRenderParams = nullptr;
 
 SkyBillboardStruct SkyBillboard;  // skybox planes
 
+// Distance from the map edge at which we start prefetching the next map.
+static constexpr int prefetchEdgeDistance = 2048;
+
 static constexpr IndexedArray<std::array<MapId, 4>, MAP_EMERALD_ISLAND, MAP_SHOALS> footTravelDestinations = {
     // from                      north                south                east                 west
     {MAP_EMERALD_ISLAND,        {MAP_INVALID,         MAP_INVALID,         MAP_INVALID,         MAP_INVALID}},
@@ -196,7 +202,7 @@ void OutdoorLocation::ExecDraw(unsigned int bRedraw) {
 
     uNumDecorationsDrawnThisFrame = 0;
     uNumSpritesDrawnThisFrame = 0;
-    uNumBillboardsToDraw = 0;
+    pBillboardRenderList.clear();
 
     PrepareActorsDrawList();
 
@@ -280,8 +286,33 @@ bool OutdoorLocation::Initialize(std::string_view filename, int days_played,
     return false;
 }
 
+/**
+ * @param partyX                        Party x position.
+ * @param partyY                        Party y position.
+ * @param distance                      Distance from the center of the map that counts as the map edge.
+ * @return                              Index into `footTravelDestinations` for the map edge the party is past, or -1
+ *                                      if the party is not past any edge.
+ */
+static int travelDirection(int partyX, int partyY, float distance) {
+    if (partyX < -distance)
+        return 3; // west
+    if (partyX > distance)
+        return 2; // east
+    if (partyY < -distance)
+        return 1; // south
+    if (partyY > distance)
+        return 0; // north
+    return -1;
+}
+
+static bool wholePartyUnderwaterSuitEquipped() {
+    for (Character &player : pParty->pCharacters)
+        if (!player.hasUnderwaterSuitEquipped())
+            return false;
+    return true;
+}
+
 MapId OutdoorLocation::getTravelDestination(int partyX, int partyY) {
-    int direction;
     MapId currentMap = engine->_currentLoadedMapId;
     MapId destinationMap;
 
@@ -289,27 +320,12 @@ MapId OutdoorLocation::getTravelDestination(int partyX, int partyY) {
         return MAP_INVALID;
 
     // Check which side of the map
-    if (partyX < -maxPartyAxisDistance)
-        direction = 3; // west
-    else if (partyX > maxPartyAxisDistance)
-        direction = 2; // east
-    else if (partyY < -maxPartyAxisDistance)
-        direction = 1; // south
-    else if (partyY > maxPartyAxisDistance)
-        direction = 0; // north
-    else
+    int direction = travelDirection(partyX, partyY, maxPartyAxisDistance);
+    if (direction == -1)
         return MAP_INVALID;
 
     if (currentMap == MAP_AVLEE && direction == 3) {  // to Shoals
-        bool wholePartyUnderwaterSuitEquipped = true;
-        for (Character &player : pParty->pCharacters) {
-            if (!player.hasUnderwaterSuitEquipped()) {
-                wholePartyUnderwaterSuitEquipped = false;
-                break;
-            }
-        }
-
-        if (wholePartyUnderwaterSuitEquipped) {
+        if (wholePartyUnderwaterSuitEquipped()) {
             uDefaultTravelTime_ByFoot = 1;
             uLevel_StartingPointType = MAP_START_POINT_EAST;
             pParty->uFlags &= ~(PARTY_FLAG_BURNING | PARTY_FLAG_STANDING_ON_WATER | PARTY_FLAG_WATER_DAMAGE);
@@ -332,6 +348,22 @@ MapId OutdoorLocation::getTravelDestination(int partyX, int partyY) {
     return destinationMap;
 }
 
+MapId OutdoorLocation::peekTravelDestination(int partyX, int partyY, int margin) const {
+    MapId currentMap = engine->_currentLoadedMapId;
+    if (!isMapOutdoor(currentMap))
+        return MAP_INVALID;
+
+    int direction = travelDirection(partyX, partyY, maxPartyAxisDistance - margin);
+    if (direction == -1)
+        return MAP_INVALID;
+
+    if (currentMap == MAP_AVLEE && direction == 3 && wholePartyUnderwaterSuitEquipped())
+        return MAP_SHOALS;
+    if (currentMap == MAP_SHOALS && direction == 2)
+        return MAP_AVLEE;
+    return footTravelDestinations[currentMap][direction];
+}
+
 //----- (004892E6) --------------------------------------------------------
 void OutdoorLocation::UpdateSunlightVectors() {
     unsigned int minutes;  // edi@3
@@ -417,6 +449,7 @@ void OutdoorLocation::CreateDebugLocation() {
 
     this->pTerrain.createDebugTerrain();
     this->pSpawnPoints.clear();
+    this->faceGrid.build(this->pBModels);
 
     this->pOMAP.fill(0);
     this->pFaceIDLIST.clear();
@@ -432,6 +465,7 @@ void OutdoorLocation::Release() {
     this->sky_texture_filename = "sky043";
 
     pBModels.clear();
+    faceGrid.clear();
     pSpawnPoints.clear();
     pFaceIDLIST.clear();
 
@@ -470,8 +504,10 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     odm_filename.replace(odm_filename.length() - 4, 4, ".odm");
 
     OutdoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
+    if (!TakePrefetchedLocation(odm_filename, &location))
+        deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
     reconstruct(location, this);
+    faceGrid.build(pBModels);
 
     // ****************.ddm file*********************//
 
@@ -480,7 +516,7 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     OutdoorDelta_MM7 delta;
-    if (Blob blob = lod::decodeCompressed(pSave_LOD->read(ddm_filename))) {
+    if (Blob blob = ReadLocationDelta(ddm_filename)) {
         try {
             deserialize(blob, &delta, tags::context(location));
 
@@ -714,8 +750,6 @@ void OutdoorLocation::PrepareActorsDrawList() {
             continue;
         }
 
-        if (uNumBillboardsToDraw >= 500) return;
-
         // view culling
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
             bool onlist = false;
@@ -812,46 +846,44 @@ void OutdoorLocation::PrepareActorsDrawList() {
                 if (projected_x + screen_space_half_width >= (signed int)pViewport->viewportTL_X &&
                     projected_x - screen_space_half_width <= (signed int)pViewport->viewportBR_X) {
                     if (projected_y >= pViewport->viewportTL_Y && (projected_y - screen_space_height) <= pViewport->viewportBR_Y) { // test
-                        ++uNumBillboardsToDraw;
                         ++uNumSpritesDrawnThisFrame;
 
                         pActors[i].attributes |= ACTOR_VISIBLE;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].hwsprite = frame->hw_sprites[Sprite_Octant];
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].uIndoorSectorID = pActors[i].sectorId;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].uPaletteIndex = frame->GetPaletteIndex();
+                        RenderBillboard &billboard = pBillboardRenderList.emplace_back();
+                        billboard.hwsprite = frame->hw_sprites[Sprite_Octant];
+                        billboard.uIndoorSectorID = pActors[i].sectorId;
+                        billboard.uPaletteIndex = frame->GetPaletteIndex();
 
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_x = proj_scale;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_y = proj_scale;
+                        billboard.screenspace_projection_factor_x = proj_scale;
+                        billboard.screenspace_projection_factor_y = proj_scale;
 
                         if (pActors[i].buffs[ACTOR_BUFF_SHRINK].Active() &&
                             pActors[i].buffs[ACTOR_BUFF_SHRINK].power > 0) {
-                            pBillboardRenderList[uNumBillboardsToDraw - 1]
-                                .screenspace_projection_factor_y = 1.0f / pActors[i].buffs[ACTOR_BUFF_SHRINK].power *
-                                                                   pBillboardRenderList[uNumBillboardsToDraw - 1]
-                                .screenspace_projection_factor_y;
+                            billboard.screenspace_projection_factor_y =
+                                1.0f / pActors[i].buffs[ACTOR_BUFF_SHRINK].power *
+                                billboard.screenspace_projection_factor_y;
                         } else if (pActors[i].massDistortionTime) {
-                            pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_y =
+                            billboard.screenspace_projection_factor_y =
                                 spell_fx_renderer->_4A806F_get_mass_distortion_value(&pActors[i]) *
-                                pBillboardRenderList[uNumBillboardsToDraw - 1].screenspace_projection_factor_y;
+                                billboard.screenspace_projection_factor_y;
                         }
 
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_x = projected_x;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_y = projected_y;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].screen_space_z = view_x;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].world_x = x;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].world_y = y;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].world_z = z;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].dimming_level = 0;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].object_pid = Pid(OBJECT_Actor, i);
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].field_14_actor_id = i;
-
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].field_1E = flags | 0x200;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].pSpriteFrame = frame;
-                        pBillboardRenderList[uNumBillboardsToDraw - 1].sTintColor =
+                        billboard.screen_space_x = projected_x;
+                        billboard.screen_space_y = projected_y;
+                        billboard.screen_space_z = view_x;
+                        billboard.world_x = x;
+                        billboard.world_y = y;
+                        billboard.world_z = z;
+                        billboard.dimming_level = 0;
+                        billboard.object_pid = Pid(OBJECT_Actor, i);
+                        billboard.field_14_actor_id = i;
+
+                        billboard.field_1E = flags | 0x200;
+                        billboard.pSpriteFrame = frame;
+                        billboard.sTintColor =
                             pMonsterList->monsters[pActors[i].monsterInfo.id].tintColor;  // *((int *)&v35[v36] - 36);
                         if (pActors[i].buffs[ACTOR_BUFF_STONED].Active()) {
-                            pBillboardRenderList[uNumBillboardsToDraw - 1].field_1E =
-                                flags | 0x100;
+                            billboard.field_1E = flags | 0x100;
                         }
                     }
                 }
@@ -871,44 +903,41 @@ float ODM_GetFloorLevel(const Vec3f &pos, bool *pIsOnWater, int *faceId) {
 
     int surface_count = 1;
 
-    for (BSPModel &model : pOutdoor->pBModels) {
+    for (OutdoorFaceRef ref : pOutdoor->faceGrid.facesAt(pos.x, pos.y)) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
         if (!model.pBoundingBox.containsXY(pos.x, pos.y))
             continue;
 
-        if (model.pFaces.empty())
+        ODMFace &face = model.pFaces[ref.faceId];
+        if (face.Ethereal())
             continue;
 
-        for (ODMFace &face : model.pFaces) {
-            if (face.Ethereal())
-                continue;
-
-            if (face.uNumVertices == 0)
-                continue;
-
-            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
-                continue;
+        if (face.uNumVertices == 0)
+            continue;
 
-            if (!face.pBoundingBox.containsXY(pos.x, pos.y))
-                continue;
+        if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+            continue;
 
-            int slack = engine->config->gameplay.FloorChecksEps.value();
-            if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
-                continue;
+        if (!face.pBoundingBox.containsXY(pos.x, pos.y))
+            continue;
 
-            int floor_level;
-            if (face.uPolygonType == POLYGON_Floor) {
-                floor_level = model.pVertices[face.pVertexIDs[0]].z;
-            } else {
-                floor_level = face.zCalc.calculate(pos.x, pos.y);
-            }
-            odm_floor_level[surface_count] = floor_level;
-            current_BModel_id[surface_count] = model.index;
-            current_Face_id[surface_count] = face.index;
-            surface_count++;
+        int slack = engine->config->hot.floorChecksEps;
+        if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+            continue;
 
-            if (surface_count >= 20)
-                break;
+        int floor_level;
+        if (face.uPolygonType == POLYGON_Floor) {
+            floor_level = model.pVertices[face.pVertexIDs[0]].z;
+        } else {
+            floor_level = face.zCalc.calculate(pos.x, pos.y);
         }
+        odm_floor_level[surface_count] = floor_level;
+        current_BModel_id[surface_count] = model.index;
+        current_Face_id[surface_count] = face.index;
+        surface_count++;
+
+        if (surface_count >= 20)
+            break;
     }
 
     if (surface_count == 1) {
@@ -944,6 +973,11 @@ float ODM_GetFloorLevel(const Vec3f &pos, bool *pIsOnWater, int *faceId) {
 void ODM_UpdateUserInputAndOther() {
     ODM_ProcessPartyActions();
 
+    // Start loading the next map in the background once the party gets close to the map edge.
+    if (MapId nextMap = pOutdoor->peekTravelDestination(pParty->pos.x, pParty->pos.y, prefetchEdgeDistance);
+        nextMap != MAP_INVALID)
+        PrefetchLocation(pMapStats->pInfos[nextMap].fileName);
+
     if (pParty->pos.x < -maxPartyAxisDistance || pParty->pos.x > maxPartyAxisDistance ||
         pParty->pos.y < -maxPartyAxisDistance || pParty->pos.y > maxPartyAxisDistance) {
         MapId mapid = pOutdoor->getTravelDestination(pParty->pos.x, pParty->pos.y);
@@ -1608,7 +1642,7 @@ int GetCeilingHeight(int Party_X, signed int Party_Y, int Party_ZHeight, int *pF
             if (!face.pBoundingBox.containsXY(Party_X, Party_Y))
                 continue;
 
-            int slack = engine->config->gameplay.FloorChecksEps.value();
+            int slack = engine->config->hot.floorChecksEps;
             if (!face.Contains(Vec3f(Party_X, Party_Y, 0), model.index, slack, FACE_XY_PLANE))
                 continue;
 
@@ -1662,9 +1696,11 @@ void SetUnderwaterFog() {
 
 //----- (004706C6) --------------------------------------------------------
 void UpdateActors_ODM() {
-    if (engine->config->debug.NoActors.value())
+    if (engine->config->hot.noActors)
         return;  // uNumActors = 0;
 
+    proximityIndex.syncSpriteObjects();
+
     for (unsigned int Actor_ITR = 0; Actor_ITR < pActors.size(); ++Actor_ITR) {
         if (pActors[Actor_ITR].aiState == Removed || pActors[Actor_ITR].aiState == Disabled ||
             pActors[Actor_ITR].aiState == Summoned || !pActors[Actor_ITR].moveSpeed)
@@ -1691,7 +1727,7 @@ void UpdateActors_ODM() {
             if (pActors[Actor_ITR].aiState == Dead || pActors[Actor_ITR].aiState == Dying) {
                 if (pActors[Actor_ITR].pos.z < Floor_Level + 30) { // 30 to provide small error / rounding factor
                     if (pMonsterStats->infos[pActors[Actor_ITR].monsterInfo.id].bloodSplatOnDeath) {
-                        if (engine->config->graphics.BloodSplats.value()) {
+                        if (engine->config->hot.bloodSplats) {
                             float splatRadius = pActors[Actor_ITR].radius * engine->config->graphics.BloodSplatsMultiplier.value();
                             EngineIocContainer::ResolveDecalBuilder()->AddBloodsplat(Vec3f(pActors[Actor_ITR].pos.x, pActors[Actor_ITR].pos.y, Floor_Level + 30), colorTable.Red, splatRadius);
                         }
@@ -15,6 +15,7 @@
 #include "LocationTime.h"
 #include "LocationFunctions.h"
 #include "OutdoorTerrain.h"
+#include "OutdoorFaceGrid.h"
 
 struct DecalBuilder;
 struct SpellFxRenderer;
@@ -54,6 +55,18 @@ struct OutdoorLocation {
      * @offset 0x48902E
      */
     MapId getTravelDestination(int partyX, int partyY);
+
+    /**
+     * Same as `getTravelDestination`, but doesn't change any game state, and also works when the party is still
+     * within the map bounds.
+     *
+     * @param partyX                    Party x position.
+     * @param partyY                    Party y position.
+     * @param margin                    Distance from the map edge at which the destination is already reported.
+     * @return                          Map the party would travel to if it continued to the nearest map edge, or
+     *                                  `MAP_INVALID`.
+     */
+    MapId peekTravelDestination(int partyX, int partyY, int margin) const;
     void UpdateSunlightVectors();
     void UpdateFog();
     int getNumFoodRequiredToRestInCurrentPos(const Vec3f &pos);
@@ -81,6 +94,7 @@ struct OutdoorLocation {
     std::string sky_texture_filename;
     OutdoorTerrain pTerrain;
     std::vector<BSPModel> pBModels;
+    OutdoorFaceGrid faceGrid; // Spatial index over the faces of `pBModels`, rebuilt on load.
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
@@ -0,0 +1,94 @@
+#include "OutdoorFaceGrid.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+#include "BSPModel.h"
+
+void OutdoorFaceGrid::build(const std::vector<BSPModel> &models) {
+    clear();
+
+    // Two passes, first one counts faces per cell, second one fills in the cells. Models & faces are visited in
+    // order, so the resulting cells end up sorted.
+    std::vector<int> counts(GRID_SIZE * GRID_SIZE + 1, 0);
+    auto forEachCell = [](const BBoxf &bbox, auto &&callback) {
+        int x1 = cellCoord(bbox.x1), x2 = cellCoord(bbox.x2);
+        int y1 = cellCoord(bbox.y1), y2 = cellCoord(bbox.y2);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                callback(y * GRID_SIZE + x);
+    };
+
+    for (const BSPModel &model : models)
+        for (const ODMFace &face : model.pFaces)
+            forEachCell(face.pBoundingBox, [&](int cell) { counts[cell + 1]++; });
+
+    _cellOffsets.resize(GRID_SIZE * GRID_SIZE + 1);
+    _cellOffsets[0] = 0;
+    for (int i = 1; i <= GRID_SIZE * GRID_SIZE; i++)
+        _cellOffsets[i] = _cellOffsets[i - 1] + counts[i];
+
+    _faces.resize(_cellOffsets.back());
+    std::vector<int> positions(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    for (const BSPModel &model : models) {
+        assert(model.index >= 0 && model.index <= INT16_MAX);
+        for (const ODMFace &face : model.pFaces)
+            forEachCell(face.pBoundingBox, [&](int cell) {
+                _faces[positions[cell]++] = {static_cast<int16_t>(model.index), static_cast<int16_t>(face.index)};
+            });
+    }
+}
+
+void OutdoorFaceGrid::clear() {
+    _cellOffsets.clear();
+    _faces.clear();
+}
+
+std::span<const OutdoorFaceRef> OutdoorFaceGrid::facesAt(float x, float y) const {
+    return cell(cellCoord(x), cellCoord(y));
+}
+
+void OutdoorFaceGrid::facesIn(const BBoxf &bbox, std::vector<OutdoorFaceRef> *result) const {
+    result->clear();
+    if (_faces.empty())
+        return;
+
+    int x1 = cellCoord(bbox.x1), x2 = cellCoord(bbox.x2);
+    int y1 = cellCoord(bbox.y1), y2 = cellCoord(bbox.y2);
+    for (int y = y1; y <= y2; y++) {
+        for (int x = x1; x <= x2; x++) {
+            std::span<const OutdoorFaceRef> faces = cell(x, y);
+            result->insert(result->end(), faces.begin(), faces.end());
+        }
+    }
+
+    // Single cell is already sorted & unique. Large faces span several cells, so in general we need to dedup.
+    if (x1 != x2 || y1 != y2) {
+        std::ranges::sort(*result);
+        result->erase(std::unique(result->begin(), result->end()), result->end());
+    }
+}
+
+void OutdoorFaceGrid::facesAlong(const Vec3f &from, const Vec3f &to, std::vector<OutdoorFaceRef> *result) const {
+    // Pad by a unit so that rounding in ray-plane intersection math can't push a hit outside the query box.
+    BBoxf bbox = BBoxf::forPoints(from, to);
+    bbox.x1 -= 1;
+    bbox.x2 += 1;
+    bbox.y1 -= 1;
+    bbox.y2 += 1;
+    facesIn(bbox, result);
+}
+
+int OutdoorFaceGrid::cellCoord(float worldCoord) {
+    float cell = std::floor((worldCoord + GRID_SIZE * CELL_SIZE / 2) / CELL_SIZE);
+    return static_cast<int>(std::clamp(cell, 0.0f, static_cast<float>(GRID_SIZE - 1)));
+}
+
+std::span<const OutdoorFaceRef> OutdoorFaceGrid::cell(int x, int y) const {
+    if (_faces.empty())
+        return {};
+
+    int index = y * GRID_SIZE + x;
+    return std::span<const OutdoorFaceRef>(_faces.data() + _cellOffsets[index], _faces.data() + _cellOffsets[index + 1]);
+}
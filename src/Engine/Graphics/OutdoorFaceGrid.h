@@ -0,0 +1,70 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <compare>
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Vec.h"
+
+class BSPModel;
+
+/**
+ * Reference to a single face of an outdoor bmodel.
+ */
+struct OutdoorFaceRef {
+    int16_t modelId = 0;
+    int16_t faceId = 0;
+
+    friend constexpr auto operator<=>(const OutdoorFaceRef &l, const OutdoorFaceRef &r) = default;
+};
+
+/**
+ * Spatial index over the faces of outdoor bmodels.
+ *
+ * The index is a uniform 2D grid aligned with the 128x128 terrain grid, each cell storing the faces whose bounding
+ * boxes overlap the cell in the XY plane. Coordinates outside the map are clamped to the border cells, so the index
+ * covers the whole infinite plane.
+ *
+ * All queries return a superset of the faces that actually overlap the query region, sorted in `(modelId, faceId)`
+ * order. This is the same order in which a brute-force walk over `OutdoorLocation::pBModels` visits the faces, so
+ * the callers can keep all their checks as is and get bit-identical results.
+ */
+class OutdoorFaceGrid {
+ public:
+    static constexpr int GRID_SIZE = 128;
+    static constexpr int CELL_SIZE = 512;
+
+    void build(const std::vector<BSPModel> &models);
+    void clear();
+
+    /**
+     * @param x                         World X coordinate.
+     * @param y                         World Y coordinate.
+     * @return                          All faces whose XY bounding rect might contain the given point.
+     */
+    [[nodiscard]] std::span<const OutdoorFaceRef> facesAt(float x, float y) const;
+
+    /**
+     * @param bbox                      Query box, only the XY part is used.
+     * @param[out] result               Output vector for all faces whose XY bounding rect might intersect `bbox`.
+     *                                  Cleared by this function.
+     */
+    void facesIn(const BBoxf &bbox, std::vector<OutdoorFaceRef> *result) const;
+
+    /**
+     * @param from                      Segment start.
+     * @param to                        Segment end.
+     * @param[out] result               Output vector for all faces whose XY bounding rect might intersect the
+     *                                  bounding box of the provided segment. Cleared by this function.
+     */
+    void facesAlong(const Vec3f &from, const Vec3f &to, std::vector<OutdoorFaceRef> *result) const;
+
+ private:
+    [[nodiscard]] static int cellCoord(float worldCoord);
+    [[nodiscard]] std::span<const OutdoorFaceRef> cell(int x, int y) const;
+
+ private:
+    std::vector<int> _cellOffsets; // Offsets into `_faces`, `GRID_SIZE * GRID_SIZE + 1` elements.
+    std::vector<OutdoorFaceRef> _faces;
+};
@@ -24,7 +24,7 @@ void PaletteManager::load(LodTextureCache *lod) {
     for (int paletteId = 1; paletteId <= 999; paletteId++) {
         std::string paletteName = fmt::format("pal{:03}", paletteId);
 
-        LodImage *texture = lod->loadTexture(paletteName, false);
+        const LodImage *texture = lod->loadTexture(paletteName, false);
         if (!texture)
             continue;
 
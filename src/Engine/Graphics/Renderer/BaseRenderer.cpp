@@ -38,66 +38,10 @@ bool BaseRenderer::Initialize() {
     return true;
 }
 
-unsigned int BaseRenderer::Billboard_ProbablyAddToListAndSortByZOrder(float z) {
-    if (uNumBillboardsToDraw >= 999) {
-        return 0;
-    }
-
-    if (!uNumBillboardsToDraw) {
-        uNumBillboardsToDraw = 1;
-        return 0;
-    }
-
-    unsigned int v7 = 0;
-    for (int left = 0, right = uNumBillboardsToDraw; left < right;) {  // binsearch
-        v7 = left + (right - left) / 2;
-        if (z <= render->pBillboardRenderListD3D[v7].z_order)
-            right = v7;
-        else
-            left = v7 + 1;
-    }
-
-    if (z > render->pBillboardRenderListD3D[v7].z_order) {
-        if (v7 == render->uNumBillboardsToDraw - 1) {
-            v7 = render->uNumBillboardsToDraw;
-        } else {
-            if (render->uNumBillboardsToDraw > v7) {
-                for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7; i++) {
-                    render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - i] =
-                        render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - (i + 1)];
-                }
-            }
-            ++v7;
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    if (z <= render->pBillboardRenderListD3D[v7].z_order) {
-        if (render->uNumBillboardsToDraw > v7) {
-            for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7; i++) {
-                render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - i] =
-                    render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - (i + 1)];
-            }
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    return v7;
-}
-
-
 // TODO: Move this to sprites ?
 // combined with IndoorLocation::PrepareItemsRenderList_BLV() (0044028F)
 void BaseRenderer::DrawSpriteObjects() {
     for (unsigned int i = 0; i < pSpriteObjects.size(); ++i) {
-        // exit if we are at max sprites
-        if (::uNumBillboardsToDraw >= 500) {
-            logger->warning("Billboards Full");
-            break;
-        }
-
         SpriteObject *object = &pSpriteObjects[i];
         if (!object->uObjectDescID) {  // item probably pciked up - this also gets wiped at end of sprite anims/ particle effects
             continue;
@@ -139,7 +83,6 @@ void BaseRenderer::DrawSpriteObjects() {
             unsigned int angle = TrigLUT.atan2(x - pCamera3D->vCameraPos.x, y - pCamera3D->vCameraPos.y);
             int octant = ((TrigLUT.uIntegerPi + (TrigLUT.uIntegerPi >> 3) + object->uFacing - angle) >> 8) & 7;
 
-            pBillboardRenderList[::uNumBillboardsToDraw].hwsprite = frame->hw_sprites[octant];
             // error catching
             if (frame->hw_sprites[octant]->texture->height() == 0 || frame->hw_sprites[octant]->texture->width() == 0) {
                 logger->trace("Trying to draw sprite with empty octant texture");
@@ -189,28 +132,28 @@ void BaseRenderer::DrawSpriteObjects() {
                         projected_x - screen_space_half_width <= (signed int)pViewport->viewportBR_X) {
                         if (projected_y >= pViewport->viewportTL_Y && (projected_y - screen_space_height) <= pViewport->viewportBR_Y) {
                             object->uAttributes |= SPRITE_VISIBLE;
-                            pBillboardRenderList[::uNumBillboardsToDraw].uPaletteIndex = frame->GetPaletteIndex();
-                            pBillboardRenderList[::uNumBillboardsToDraw].uIndoorSectorID = object->uSectorID;
-                            pBillboardRenderList[::uNumBillboardsToDraw].pSpriteFrame = frame;
+                            RenderBillboard &billboard = pBillboardRenderList.emplace_back();
+                            billboard.hwsprite = frame->hw_sprites[octant];
+                            billboard.uPaletteIndex = frame->GetPaletteIndex();
+                            billboard.uIndoorSectorID = object->uSectorID;
+                            billboard.pSpriteFrame = frame;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].screenspace_projection_factor_x = billb_scale;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screenspace_projection_factor_y = billb_scale;
+                            billboard.screenspace_projection_factor_x = billb_scale;
+                            billboard.screenspace_projection_factor_y = billb_scale;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].field_1E = setflags;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_x = x;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_y = y;
-                            pBillboardRenderList[::uNumBillboardsToDraw].world_z = z;
+                            billboard.field_1E = setflags;
+                            billboard.world_x = x;
+                            billboard.world_y = y;
+                            billboard.world_z = z;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_x = projected_x;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_y = projected_y;
-                            pBillboardRenderList[::uNumBillboardsToDraw].screen_space_z = view_x;
+                            billboard.screen_space_x = projected_x;
+                            billboard.screen_space_y = projected_y;
+                            billboard.screen_space_z = view_x;
 
-                            pBillboardRenderList[::uNumBillboardsToDraw].object_pid = Pid(OBJECT_Sprite, i);
-                            pBillboardRenderList[::uNumBillboardsToDraw].dimming_level = 0;
-                            pBillboardRenderList[::uNumBillboardsToDraw].sTintColor = Color();
+                            billboard.object_pid = Pid(OBJECT_Sprite, i);
+                            billboard.dimming_level = 0;
+                            billboard.sTintColor = Color();
 
-                            assert(::uNumBillboardsToDraw < 500);
-                            ++::uNumBillboardsToDraw;
                             ++uNumSpritesDrawnThisFrame;
                         }
                     }
@@ -231,11 +174,6 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
     int v38;                // [sp+88h] [bp-1Ch]@9
 
     for (unsigned int i = 0; i < pLevelDecorations.size(); ++i) {
-        if (::uNumBillboardsToDraw >= 500) {
-            logger->warning("Billboards Full");
-            return;
-        }
-
         // view cull
         if (!IsCylinderInFrustum(pLevelDecorations[i].vPosition, 512.0f)) continue;
 
@@ -326,25 +264,25 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
                             if (projected_x + screen_space_half_width >= (signed int)pViewport->viewportTL_X &&
                                 projected_x - screen_space_half_width <= (signed int)pViewport->viewportBR_X) {
                                 if (projected_y >= pViewport->viewportTL_Y && (projected_y - screen_space_height) <= pViewport->viewportBR_Y) {
-                                    ::uNumBillboardsToDraw++;
                                     ++uNumDecorationsDrawnThisFrame;
 
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].hwsprite = frame->hw_sprites[(int64_t)v37];
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].world_x = pLevelDecorations[i].vPosition.x;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].world_y = pLevelDecorations[i].vPosition.y;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].world_z = pLevelDecorations[i].vPosition.z;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].screen_space_x = projected_x;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].screen_space_y = projected_y;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].screen_space_z = view_x;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].screenspace_projection_factor_x = _v41;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].screenspace_projection_factor_y = _v41;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].uPaletteIndex = frame->GetPaletteIndex();
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].field_1E = v38 | 0x200;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].uIndoorSectorID = 0;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].object_pid = Pid(OBJECT_Decoration, i);
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].dimming_level = 0;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].pSpriteFrame = frame;
-                                    pBillboardRenderList[::uNumBillboardsToDraw - 1].sTintColor = Color();
+                                    RenderBillboard &billboard = pBillboardRenderList.emplace_back();
+                                    billboard.hwsprite = frame->hw_sprites[(int64_t)v37];
+                                    billboard.world_x = pLevelDecorations[i].vPosition.x;
+                                    billboard.world_y = pLevelDecorations[i].vPosition.y;
+                                    billboard.world_z = pLevelDecorations[i].vPosition.z;
+                                    billboard.screen_space_x = projected_x;
+                                    billboard.screen_space_y = projected_y;
+                                    billboard.screen_space_z = view_x;
+                                    billboard.screenspace_projection_factor_x = _v41;
+                                    billboard.screenspace_projection_factor_y = _v41;
+                                    billboard.uPaletteIndex = frame->GetPaletteIndex();
+                                    billboard.field_1E = v38 | 0x200;
+                                    billboard.uIndoorSectorID = 0;
+                                    billboard.object_pid = Pid(OBJECT_Decoration, i);
+                                    billboard.dimming_level = 0;
+                                    billboard.pSpriteFrame = frame;
+                                    billboard.sTintColor = Color();
                                 }
                             }
                         }
@@ -379,9 +317,9 @@ void BaseRenderer::TransformBillboardsAndSetPalettesODM() {
     billboard.uViewportY = pViewport->viewportTL_Y;
     billboard.uViewportZ = pViewport->viewportBR_X - 1;
     billboard.uViewportW = pViewport->viewportBR_Y;
-    pODMRenderParams->uNumBillboards = ::uNumBillboardsToDraw;
+    pODMRenderParams->uNumBillboards = pBillboardRenderList.size();
 
-    for (unsigned int i = 0; i < ::uNumBillboardsToDraw; ++i) {
+    for (unsigned int i = 0; i < pBillboardRenderList.size(); ++i) {
         RenderBillboard *p = &pBillboardRenderList[i];
         if (p->hwsprite) {
             billboard.screen_space_x = p->screen_space_x;
@@ -415,8 +353,7 @@ void BaseRenderer::TransformBillboard(const SoftwareBillboard *pSoftBillboard, c
     if (pSprite->texture->height() == 0 || pSprite->texture->width() == 0)
         assert(false);
 
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(pSoftBillboard->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = addBillboardD3D();
 
     float scr_proj_x = pSoftBillboard->screenspace_projection_factor_x;
     float scr_proj_y = pSoftBillboard->screenspace_projection_factor_y;
@@ -507,8 +444,7 @@ void BaseRenderer::MakeParticleBillboardAndPush(SoftwareBillboard *a2,
                                                 GraphicsImage *texture,
                                                 Color uDiffuse,
                                                 int angle) {
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(a2->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = addBillboardD3D();
 
     billboard->opacity = RenderBillboardD3D::Opaque_1;
     billboard->field_90 = a2->field_44;
@@ -630,21 +566,21 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         }
     }
 
-    unsigned int v5 = Billboard_ProbablyAddToListAndSortByZOrder(depth);
-    pBillboardRenderListD3D[v5].field_90 = 0;
-    pBillboardRenderListD3D[v5].sParentBillboardID = -1;
-    pBillboardRenderListD3D[v5].opacity = RenderBillboardD3D::Opaque_2;
-    pBillboardRenderListD3D[v5].texture = 0;
-    pBillboardRenderListD3D[v5].uNumVertices = a1->uNumVertices;
-    pBillboardRenderListD3D[v5].z_order = depth;
-    pBillboardRenderListD3D[v5].PaletteIndex = 0;
+    RenderBillboardD3D *billboard = addBillboardD3D();
+    billboard->field_90 = 0;
+    billboard->sParentBillboardID = -1;
+    billboard->opacity = RenderBillboardD3D::Opaque_2;
+    billboard->texture = 0;
+    billboard->uNumVertices = a1->uNumVertices;
+    billboard->z_order = depth;
+    billboard->PaletteIndex = 0;
 
-    pBillboardRenderListD3D[v5].pQuads[3].pos.x = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.y = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.z = 0.0f;
+    billboard->pQuads[3].pos.x = 0.0f;
+    billboard->pQuads[3].pos.y = 0.0f;
+    billboard->pQuads[3].pos.z = 0.0f;
 
     for (unsigned int i = 0; i < (unsigned int)a1->uNumVertices; ++i) {
-        pBillboardRenderListD3D[v5].pQuads[i].pos = a1->field_104[i].pos;
+        billboard->pQuads[i].pos = a1->field_104[i].pos;
 
         float rhw = 1.f / a1->field_104[i].pos.z;
         float z = 1.f - 1.f / (a1->field_104[i].pos.z * 1000.f / pCamera3D->GetFarClip());
@@ -652,7 +588,7 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         double v10 = a1->field_104[i].pos.z;
         v10 *= 1000.f / pCamera3D->GetFarClip();
 
-        pBillboardRenderListD3D[v5].pQuads[i].rhw = rhw;
+        billboard->pQuads[i].rhw = rhw;
 
         Color v12;
         if (diffuse.a) {
@@ -660,11 +596,11 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         } else {
             v12 = diffuse;
         }
-        pBillboardRenderListD3D[v5].pQuads[i].diffuse = v12;
-        pBillboardRenderListD3D[v5].pQuads[i].specular = Color();
+        billboard->pQuads[i].diffuse = v12;
+        billboard->pQuads[i].specular = Color();
 
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.x = 0.5;
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.y = 0.5;
+        billboard->pQuads[i].texcoord.x = 0.5;
+        billboard->pQuads[i].texcoord.y = 0.5;
     }
 }
 
@@ -700,7 +636,8 @@ void BaseRenderer::DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() {
 std::vector<Actor*> BaseRenderer::getActorsInViewport(int pDepth) {
     std::vector<Actor*> foundActors;
 
-    for (int i = 0; i < render->uNumBillboardsToDraw; i++) {
+    render->sortBillboardsD3D();
+    for (size_t i = 0; i < render->pBillboardRenderListD3D.size(); i++) {
         int renderId = render->pBillboardRenderListD3D[i].sParentBillboardID;
         if(renderId == -1) {
             continue; // E.g. spell particle.
@@ -52,7 +52,6 @@ class BaseRenderer : public Renderer {
     virtual Sizei GetPresentDimensions() override;
 
  protected:
-    unsigned int Billboard_ProbablyAddToListAndSortByZOrder(float z);
     void TransformBillboard(const SoftwareBillboard *a2, const RenderBillboard *pBillboard);
 
  protected:
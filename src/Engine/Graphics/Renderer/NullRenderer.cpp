@@ -36,7 +36,7 @@ void NullRenderer::DrawLines(const RenderVertexD3D3 *vertices, int num_vertices)
 
 void NullRenderer::BeginScene3D() {
     // TODO(captainurist): doesn't belong here.
-    uNumBillboardsToDraw = 0;
+    clearBillboardsD3D();
 }
 
 void NullRenderer::DrawProjectile(float srcX, float srcY, float a3, float a4,
@@ -108,6 +108,12 @@ void NullRenderer::DrawIndoorFaces() {}
 void NullRenderer::ReleaseTerrain() {}
 void NullRenderer::ReleaseBSP() {}
 
+void NullRenderer::invalidateIndoorFaceGeometry(std::span<const int16_t> faceIds) {}
+
+GeometryCacheStats NullRenderer::geometryCacheStats() const {
+    return {};
+}
+
 void NullRenderer::DrawTwodVerts() {}
 
 bool NullRenderer::ReloadShaders() { return true; }
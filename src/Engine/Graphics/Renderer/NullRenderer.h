@@ -81,6 +81,9 @@ class NullRenderer : public BaseRenderer {
     virtual void ReleaseTerrain() override;
     virtual void ReleaseBSP() override;
 
+    virtual void invalidateIndoorFaceGeometry(std::span<const int16_t> faceIds) override;
+    virtual GeometryCacheStats geometryCacheStats() const override;
+
     virtual void DrawTwodVerts() override;
 
     virtual bool ReloadShaders() override;
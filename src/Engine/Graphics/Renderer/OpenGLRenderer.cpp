@@ -62,8 +62,7 @@ static constexpr int DEFAULT_AMBIENT_LIGHT_LEVEL = 0;
 // globals
 //TODO(pskelton): Combine and contain
 int uNumDecorationsDrawnThisFrame;
-RenderBillboard pBillboardRenderList[500];
-unsigned int uNumBillboardsToDraw;
+std::vector<RenderBillboard> pBillboardRenderList;
 int uNumSpritesDrawnThisFrame;
 RenderVertexSoft array_73D150[20];
 RenderVertexSoft VertexRenderList[50];
@@ -346,7 +345,7 @@ void OpenGLRenderer::BeginScene3D() {
     glClearDepthf(1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    render->uNumBillboardsToDraw = 0;  // moved from drawbillboards - cant reset this until mouse picking finished
+    render->clearBillboardsD3D();  // moved from drawbillboards - cant reset this until mouse picking finished
 
     SetFogParametersGL();
     gamma = GetGamma();
@@ -2382,7 +2381,8 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
     float oneon = 1.0f / (pCamera3D->GetNearClip() * 2.0f);
     float oneof = 1.0f / (pCamera3D->GetFarClip());
 
-    for (int i = uNumBillboardsToDraw - 1; i >= 0; --i) {
+    sortBillboardsD3D();
+    for (int i = static_cast<int>(pBillboardRenderListD3D.size()) - 1; i >= 0; --i) {
         //if (pBillboardRenderListD3D[i].opacity != RenderBillboardD3D::NoBlend) {
         //    if (blendtrack != pBillboardRenderListD3D[i].opacity) {
         //        blendtrack = pBillboardRenderListD3D[i].opacity;
@@ -2407,7 +2407,6 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
         //}
 
         auto billboard = &pBillboardRenderListD3D[i];
-        auto b = &pBillboardRenderList[i];
 
         float oneoz = 1.0f / billboard->screen_space_z;
         float thisdepth = (oneoz - oneon) / (oneof - oneon);
@@ -3149,8 +3148,125 @@ void OpenGLRenderer::Present() {
     swapBuffers();
 }
 
-GLshaderverts *outbuildshaderstore[16] = { nullptr };
-int numoutbuildverts[16] = { 0 };
+/**
+ * Uploads `GeometryCache` contents into per-batch vertex & index buffers. Index buffer binding is a part of the VAO
+ * state, so VAOs are needed too.
+ */
+class OpenGLGeometryUploader : public GeometryUploader {
+ public:
+    OpenGLGeometryUploader(GLuint *vaos, GLuint *vbos, GLuint *ebos) : _vaos(vaos), _vbos(vbos), _ebos(ebos) {}
+
+    virtual void reserveVertices(int batch, int capacity) override {
+        glBindBuffer(GL_ARRAY_BUFFER, _vbos[batch]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GeometryVertex) * capacity, NULL, GL_DYNAMIC_DRAW);
+    }
+
+    virtual void uploadVertices(int batch, int offset, std::span<const GeometryVertex> vertices) override {
+        glBindBuffer(GL_ARRAY_BUFFER, _vbos[batch]);
+        glBufferSubData(GL_ARRAY_BUFFER, sizeof(GeometryVertex) * offset, vertices.size_bytes(), vertices.data());
+    }
+
+    virtual void uploadIndices(int batch, std::span<const uint32_t> indices) override {
+        glBindVertexArray(_vaos[batch]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebos[batch]);
+        // orphan & refill, draw lists are rebuilt every frame
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size_bytes(), indices.data(), GL_STREAM_DRAW);
+    }
+
+ private:
+    GLuint *_vaos = nullptr;
+    GLuint *_vbos = nullptr;
+    GLuint *_ebos = nullptr;
+};
+
+static void setupGeometryVertexArray(GLuint *vao, GLuint *vbo, GLuint *ebo) {
+    glGenVertexArrays(1, vao);
+    glGenBuffers(1, vbo);
+    glGenBuffers(1, ebo);
+
+    glBindVertexArray(*vao);
+    glBindBuffer(GL_ARRAY_BUFFER, *vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *ebo);
+
+    // storage is allocated on first GeometryCache::flush
+
+    // position attribute
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, x));
+    glEnableVertexAttribArray(0);
+    // tex uv attribute
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, u));
+    glEnableVertexAttribArray(1);
+    // tex unit attribute
+    // tex array layer attribute
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, texunit));
+    glEnableVertexAttribArray(2);
+    // normals
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, normx));
+    glEnableVertexAttribArray(3);
+    // attribs
+    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, attribs));
+    glEnableVertexAttribArray(4);
+    // sector
+    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void *)offsetof(GeometryVertex, sector));
+    glEnableVertexAttribArray(5);
+
+    glBindVertexArray(0);
+}
+
+static int outdoorFaceAttributes(const ODMFace &face) {
+    int attribflags = 0;
+
+    if (face.uAttributes & FACE_IsFluid)
+        attribflags |= 2;
+    if (face.uAttributes & FACE_INDOOR_SKY)
+        attribflags |= 0x400;
+
+    if (face.uAttributes & FACE_FlowDown)
+        attribflags |= 0x400;
+    else if (face.uAttributes & FACE_FlowUp)
+        attribflags |= 0x800;
+
+    if (face.uAttributes & FACE_FlowRight)
+        attribflags |= 0x2000;
+    else if (face.uAttributes & FACE_FlowLeft)
+        attribflags |= 0x1000;
+
+    if (face.uAttributes & FACE_IsLava)
+        attribflags |= 0x4000;
+
+    if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
+        attribflags |= 0x00010000;
+
+    return attribflags;
+}
+
+static void buildOutdoorFaceVertices(const BSPModel &model, const ODMFace &face, int texunit, int texlayer,
+                                     int attribflags, std::vector<GeometryVertex> *vertices) {
+    vertices->clear();
+
+    auto pushVertex = [&](int i) {
+        GeometryVertex &thisvert = vertices->emplace_back();
+        thisvert.x = model.pVertices[face.pVertexIDs[i]].x;
+        thisvert.y = model.pVertices[face.pVertexIDs[i]].y;
+        thisvert.z = model.pVertices[face.pVertexIDs[i]].z;
+        thisvert.u = face.pTextureUIDs[i] + face.sTextureDeltaU;
+        thisvert.v = face.pTextureVIDs[i] + face.sTextureDeltaV;
+        thisvert.texunit = texunit;
+        thisvert.texturelayer = texlayer;
+        thisvert.normx = face.facePlane.normal.x;
+        thisvert.normy = face.facePlane.normal.y;
+        thisvert.normz = face.facePlane.normal.z;
+        thisvert.attribs = attribflags;
+        thisvert.sector = 0;
+    };
+
+    for (int z = 0; z < (face.uNumVertices - 2); z++) {
+        // 123, 134, 145, 156..
+        pushVertex(0);
+        pushVertex(z + 1);
+        pushVertex(z + 2);
+    }
+}
 
 void OpenGLRenderer::DrawOutdoorBuildings() {
     // shader
@@ -3167,32 +3283,9 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     _set_3d_projection_matrix();
     _set_3d_modelview_matrix();
 
-    if (outbuildVAO[0] == 0) {
-        // count all triangles
-        // make out build shader store
-        int verttotals = 0;
-
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-
-            //for (BSPModel &model : pOutdoor->pBModels) {
-            //    //int reachable;
-            //    //if (IsBModelVisible(&model, &reachable)) {
-            //    //model.field_40 |= 1;
-            //    if (!model.pFaces.empty()) {
-            //        for (ODMFace &face : model.pFaces) {
-            //            if (!face.Invisible()) {
-            //                numoutbuildverts += 3 * (face.uNumVertices - 2);
-            //            }
-            //        }
-            //    }
-            //}
-
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-            outbuildshaderstore[i] = (GLshaderverts *)malloc(sizeof(GLshaderverts) * 20000);
-        }
+    outbuildgeometry.beginFrame();
 
+    if (outbuildVAO[0] == 0) {
         // reserve first 7 layers for water tiles in unit 0
         auto wtrtexture = this->hd_water_tile_anim[0];
         //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
@@ -3327,31 +3420,26 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             //}
         }
 
-        for (int l = 0; l < 16; l++) {
-            glGenVertexArrays(1, &outbuildVAO[l]);
-            glGenBuffers(1, &outbuildVBO[l]);
-
-            glBindVertexArray(outbuildVAO[l]);
-            glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-
-            glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, outbuildshaderstore[l], GL_DYNAMIC_DRAW);
-
-            // position attribute
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-            glEnableVertexAttribArray(0);
-            // tex uv attribute
-            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-            glEnableVertexAttribArray(1);
-            // tex unit attribute
-            // tex array layer attribute
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-            glEnableVertexAttribArray(2);
-            // normals
-            glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-            glEnableVertexAttribArray(3);
-            // attribs - not used here yet
-            glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-            glEnableVertexAttribArray(4);
+        for (int l = 0; l < 16; l++)
+            setupGeometryVertexArray(&outbuildVAO[l], &outbuildVBO[l], &outbuildEBO[l]);
+
+        // build vertex data for all faces once, after this only the faces that change are rebuilt
+        outbuildgeometry.clear();
+        outbuildfaceoffsets.clear();
+        int facecount = 0;
+        std::vector<GeometryVertex> faceverts;
+        for (BSPModel &model : pOutdoor->pBModels) {
+            outbuildfaceoffsets.push_back(facecount);
+            for (ODMFace &face : model.pFaces) {
+                if (!face.Invisible() && face.GetTexture()) {
+                    int attribflags = outdoorFaceAttributes(face);
+                    buildOutdoorFaceVertices(model, face, face.texunit, face.texlayer, attribflags, &faceverts);
+                    outbuildgeometry.update(facecount + face.index, face.texunit,
+                                            {face.texlayer, attribflags, face.sTextureDeltaU, face.sTextureDeltaV},
+                                            faceverts);
+                }
+            }
+            facecount += model.pFaces.size();
         }
 
         // texture set up
@@ -3414,10 +3502,8 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         }
     }
 
-        // else update verts - blank store
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-        }
+        // else update verts - only faces that have changed are rebuilt
+        std::vector<GeometryVertex> faceverts;
 
         for (BSPModel &model : pOutdoor->pBModels) {
             bool reachable;
@@ -3458,67 +3544,14 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
                                     }
                                 }
 
-                                int attribflags = 0;
-
-                                if (face.uAttributes & FACE_IsFluid)
-                                    attribflags |= 2;
-                                if (face.uAttributes & FACE_INDOOR_SKY)
-                                    attribflags |= 0x400;
-
-                                if (face.uAttributes & FACE_FlowDown)
-                                    attribflags |= 0x400;
-                                else if (face.uAttributes & FACE_FlowUp)
-                                    attribflags |= 0x800;
-
-                                if (face.uAttributes & FACE_FlowRight)
-                                    attribflags |= 0x2000;
-                                else if (face.uAttributes & FACE_FlowLeft)
-                                    attribflags |= 0x1000;
-
-                                if (face.uAttributes & FACE_IsLava)
-                                    attribflags |= 0x4000;
-
-                                if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
-                                    attribflags |= 0x00010000;
-
-                                // load up verts here
-                                for (int z = 0; z < (face.uNumVertices - 2); z++) {
-                                    // 123, 134, 145, 156..
-                                    GLshaderverts *thisvert = &outbuildshaderstore[texunit][numoutbuildverts[texunit]];
-
-                                    // copy first
-                                    thisvert->x = model.pVertices[face.pVertexIDs[0]].x;
-                                    thisvert->y = model.pVertices[face.pVertexIDs[0]].y;
-                                    thisvert->z = model.pVertices[face.pVertexIDs[0]].z;
-                                    thisvert->u = face.pTextureUIDs[0] + face.sTextureDeltaU;
-                                    thisvert->v = face.pTextureVIDs[0] + face.sTextureDeltaV;
-                                    thisvert->texunit = texunit;
-                                    thisvert->texturelayer = texlayer;
-                                    thisvert->normx = face.facePlane.normal.x;
-                                    thisvert->normy = face.facePlane.normal.y;
-                                    thisvert->normz = face.facePlane.normal.z;
-                                    thisvert->attribs = attribflags;
-                                    thisvert++;
-
-                                    // copy other two (z+1)(z+2)
-                                    for (unsigned i = 1; i < 3; ++i) {
-                                        thisvert->x = model.pVertices[face.pVertexIDs[z + i]].x;
-                                        thisvert->y = model.pVertices[face.pVertexIDs[z + i]].y;
-                                        thisvert->z = model.pVertices[face.pVertexIDs[z + i]].z;
-                                        thisvert->u = face.pTextureUIDs[z + i] + face.sTextureDeltaU;
-                                        thisvert->v = face.pTextureVIDs[z + i] + face.sTextureDeltaV;
-                                        thisvert->texunit = texunit;
-                                        thisvert->texturelayer = texlayer;
-                                        thisvert->normx = face.facePlane.normal.x;
-                                        thisvert->normy = face.facePlane.normal.y;
-                                        thisvert->normz = face.facePlane.normal.z;
-                                        thisvert->attribs = attribflags;
-                                        thisvert++;
-                                    }
-
-                                    numoutbuildverts[texunit] += 3;
-                                    assert(numoutbuildverts[texunit] <= 9999);
+                                int attribflags = outdoorFaceAttributes(face);
+                                int faceid = outbuildfaceoffsets[model.index] + face.index;
+                                GeometryFaceState state = {texlayer, attribflags, face.sTextureDeltaU, face.sTextureDeltaV};
+                                if (outbuildgeometry.needsUpdate(faceid, texunit, state)) {
+                                    buildOutdoorFaceVertices(model, face, texunit, texlayer, attribflags, &faceverts);
+                                    outbuildgeometry.update(faceid, texunit, state, faceverts);
                                 }
+                                outbuildgeometry.draw(faceid);
                             }
                         }
                     }
@@ -3526,16 +3559,11 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             }
         }
 
-        for (int l = 0; l < 16; l++) {
-            if (numoutbuildverts[l]) {
-                glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-                // orphan buffer
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                // update buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numoutbuildverts[l], outbuildshaderstore[l]);
-            }
-        }
+        // upload only what has changed, plus this frame's draw lists
+        OpenGLGeometryUploader uploader(outbuildVAO, outbuildVBO, outbuildEBO);
+        outbuildgeometry.flush(&uploader);
 
+        glBindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // terrain debug
@@ -3691,7 +3719,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
             glBindVertexArray(outbuildVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numoutbuildverts[unit]));
+            glDrawElements(GL_TRIANGLES, outbuildgeometry.drawList(unit).size(), GL_UNSIGNED_INT, 0);
             drawcalls++;
         //}
     }
@@ -3773,8 +3801,63 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     ///////////////// shader end
 }
 
-GLshaderverts *BSPshaderstore[16] = { nullptr };
-int numBSPverts[16] = { 0 };
+static int indoorFaceAttributes(const BLVFace &face) {
+    int attribflags = 0;
+
+    if (face.uAttributes & FACE_IsFluid)
+        attribflags |= 2;
+
+    if (face.uAttributes & FACE_FlowDown)
+        attribflags |= 0x400;
+    else if (face.uAttributes & FACE_FlowUp)
+        attribflags |= 0x800;
+
+    if (face.uAttributes & FACE_FlowRight)
+        attribflags |= 0x2000;
+    else if (face.uAttributes & FACE_FlowLeft)
+        attribflags |= 0x1000;
+
+    if (face.uAttributes & FACE_IsLava)
+        attribflags |= 0x4000;
+
+    if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
+        attribflags |= 0x00010000;
+
+    return attribflags;
+}
+
+static void buildIndoorFaceVertices(const BLVFace &face, int texunit, int texlayer, int attribflags,
+                                    float skymodtimex, float skymodtimey, std::vector<GeometryVertex> *vertices) {
+    vertices->clear();
+
+    const BLVFaceExtra &extra = pIndoor->pFaceExtras[face.uFaceExtraID];
+    auto pushVertex = [&](int i) {
+        GeometryVertex &thisvert = vertices->emplace_back();
+        thisvert.x = pIndoor->pVertices[face.pVertexIDs[i]].x;
+        thisvert.y = pIndoor->pVertices[face.pVertexIDs[i]].y;
+        thisvert.z = pIndoor->pVertices[face.pVertexIDs[i]].z;
+        thisvert.u = face.pVertexUIDs[i] + extra.sTextureDeltaU;
+        thisvert.v = face.pVertexVIDs[i] + extra.sTextureDeltaV;
+        if (face.Indoor_sky()) {
+            thisvert.u = (skymodtimex + thisvert.u) * 0.25f;
+            thisvert.v = (skymodtimey + thisvert.v) * 0.25f;
+        }
+        thisvert.texunit = texunit;
+        thisvert.texturelayer = texlayer;
+        thisvert.normx = face.facePlane.normal.x;
+        thisvert.normy = face.facePlane.normal.y;
+        thisvert.normz = face.facePlane.normal.z;
+        thisvert.attribs = attribflags;
+        thisvert.sector = face.uSectorID;
+    };
+
+    for (int z = 0; z < (face.uNumVertices - 2); z++) {
+        // 123, 134, 145, 156..
+        pushVertex(0);
+        pushVertex(z + 1);
+        pushVertex(z + 2);
+    }
+}
 
 void OpenGLRenderer::DrawIndoorFaces() {
     // void RenderOpenGL::DrawIndoorBSP() {
@@ -3794,6 +3877,8 @@ void OpenGLRenderer::DrawIndoorFaces() {
         _set_3d_projection_matrix();
         _set_3d_modelview_matrix();
 
+        bspgeometry.beginFrame();
+
         if (bspVAO[0] == 0) {
             // lights setup
             int cntnosect = 0;
@@ -3810,13 +3895,6 @@ void OpenGLRenderer::DrawIndoorFaces() {
             if (cntnosect)
                 logger->warning("{} lights - sector not found", cntnosect);
 
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-                free(BSPshaderstore[i]);
-                BSPshaderstore[i] = nullptr;
-                BSPshaderstore[i] = (GLshaderverts*)malloc(sizeof(GLshaderverts) * 20000);
-            }
-
 
             // reserve first 7 layers for water tiles in unit 0
             auto wtrtexture = this->hd_water_tile_anim[0];
@@ -3922,34 +4000,25 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 face->texlayer = texlayer;
             }
 
-            for (int l = 0; l < 16; l++) {
-                glGenVertexArrays(1, &bspVAO[l]);
-                glGenBuffers(1, &bspVBO[l]);
-
-                glBindVertexArray(bspVAO[l]);
-                glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-
-                // position attribute
-                glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-                glEnableVertexAttribArray(0);
-                // tex uv attribute
-                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-                glEnableVertexAttribArray(1);
-                // tex unit attribute
-                // tex array layer attribute
-                glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-                glEnableVertexAttribArray(2);
-                // normals
-                glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-                glEnableVertexAttribArray(3);
-                // attribs
-                glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-                glEnableVertexAttribArray(4);
-                //sector
-                glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void*)offsetof(GLshaderverts, sector));
-                glEnableVertexAttribArray(5);
+            for (int l = 0; l < 16; l++)
+                setupGeometryVertexArray(&bspVAO[l], &bspVBO[l], &bspEBO[l]);
+
+            // build vertex data for all faces once, after this only the faces that change are rebuilt
+            bspgeometry.clear();
+            std::vector<GeometryVertex> faceverts;
+            for (int faceid = 0; faceid < pIndoor->pFaces.size(); faceid++) {
+                BLVFace *face = &pIndoor->pFaces[faceid];
+                if (face->isPortal() || !face->GetTexture())
+                    continue;
+                // forced perspective sky is drawn separately
+                if (face->Indoor_sky() && face->uPolygonType != POLYGON_InBetweenFloorAndWall && face->uPolygonType != POLYGON_Floor)
+                    continue;
+
+                const BLVFaceExtra &extra = pIndoor->pFaceExtras[face->uFaceExtraID];
+                int attribflags = indoorFaceAttributes(*face);
+                buildIndoorFaceVertices(*face, face->texunit, face->texlayer, attribflags, 0.0f, 0.0f, &faceverts);
+                bspgeometry.update(faceid, face->texunit, {face->texlayer, attribflags, extra.sTextureDeltaU, extra.sTextureDeltaV},
+                                   faceverts);
             }
 
             // texture set up
@@ -4002,11 +4071,8 @@ void OpenGLRenderer::DrawIndoorFaces() {
         }
 
 
-            // update verts - blank store
-
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-            }
+            // update verts - only faces that have changed are rebuilt
+            std::vector<GeometryVertex> faceverts;
 
             bool drawnsky = false;
 
@@ -4032,26 +4098,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 // load up verts here
                 int texlayer = 0;
                 int texunit = 0;
-                int attribflags = 0;
-
-                if (face->uAttributes & FACE_IsFluid)
-                    attribflags |= 2;
-
-                if (face->uAttributes & FACE_FlowDown)
-                    attribflags |= 0x400;
-                else if (face->uAttributes & FACE_FlowUp)
-                    attribflags |= 0x800;
-
-                if (face->uAttributes & FACE_FlowRight)
-                    attribflags |= 0x2000;
-                else if (face->uAttributes & FACE_FlowLeft)
-                    attribflags |= 0x1000;
-
-                if (face->uAttributes & FACE_IsLava)
-                    attribflags |= 0x4000;
-
-                if (face->uAttributes & FACE_OUTLINED || (face->uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
-                    attribflags |= 0x00010000;
+                int attribflags = indoorFaceAttributes(*face);
 
                 if (face->IsTextureFrameTable()) {
                     texlayer = -1;
@@ -4078,66 +4125,24 @@ void OpenGLRenderer::DrawIndoorFaces() {
                     }
                 }
 
+                // sky floors scroll with time & camera position, so these are rebuilt every frame
+                if (face->Indoor_sky())
+                    bspgeometry.invalidate(uFaceID);
 
-                for (int z = 0; z < (face->uNumVertices - 2); z++) {
-                    // 123, 134, 145, 156..
-                    GLshaderverts *thisvert = &BSPshaderstore[texunit][numBSPverts[texunit]];
-
-                    // copy first
-                    thisvert->x = pIndoor->pVertices[face->pVertexIDs[0]].x;
-                    thisvert->y = pIndoor->pVertices[face->pVertexIDs[0]].y;
-                    thisvert->z = pIndoor->pVertices[face->pVertexIDs[0]].z;
-                    thisvert->u = face->pVertexUIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                    thisvert->v = face->pVertexVIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
-                    if (face->Indoor_sky()) {
-                        thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                        thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
-                    }
-                    thisvert->texunit = texunit;
-                    thisvert->texturelayer = texlayer;
-                    thisvert->normx = face->facePlane.normal.x;
-                    thisvert->normy = face->facePlane.normal.y;
-                    thisvert->normz = face->facePlane.normal.z;
-                    thisvert->attribs = attribflags;
-                    thisvert->sector = face->uSectorID;
-                    thisvert++;
-
-                    // copy other two (z+1)(z+2)
-                    for (unsigned i = 1; i < 3; ++i) {
-                        thisvert->x = pIndoor->pVertices[face->pVertexIDs[z + i]].x;
-                        thisvert->y = pIndoor->pVertices[face->pVertexIDs[z + i]].y;
-                        thisvert->z = pIndoor->pVertices[face->pVertexIDs[z + i]].z;
-                        thisvert->u = face->pVertexUIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                        thisvert->v = face->pVertexVIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
-                        if (face->Indoor_sky()) {
-                            thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                            thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
-                        }
-                        thisvert->texunit = texunit;
-                        thisvert->texturelayer = texlayer;
-                        thisvert->normx = face->facePlane.normal.x;
-                        thisvert->normy = face->facePlane.normal.y;
-                        thisvert->normz = face->facePlane.normal.z;
-                        thisvert->attribs = attribflags;
-                        thisvert->sector = face->uSectorID;
-                        thisvert++;
-                    }
-
-                    numBSPverts[texunit] += 3;
-                    assert(numBSPverts[texunit] <= 19999);
+                const BLVFaceExtra &extra = pIndoor->pFaceExtras[face->uFaceExtraID];
+                GeometryFaceState state = {texlayer, attribflags, extra.sTextureDeltaU, extra.sTextureDeltaV};
+                if (bspgeometry.needsUpdate(uFaceID, texunit, state)) {
+                    buildIndoorFaceVertices(*face, texunit, texlayer, attribflags, skymodtimex, skymodtimey, &faceverts);
+                    bspgeometry.update(uFaceID, texunit, state, faceverts);
                 }
+                bspgeometry.draw(uFaceID);
             }
 
-            for (int l = 0; l < 16; l++) {
-                if (numBSPverts[l]) {
-                    glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-                    // orphan buffer
-                    glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                    // update buffer
-                    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numBSPverts[l], BSPshaderstore[l]);
-                }
-            }
+            // upload only what has changed, plus this frame's draw lists
+            OpenGLGeometryUploader uploader(bspVAO, bspVBO, bspEBO);
+            bspgeometry.flush(&uploader);
 
+            glBindVertexArray(0);
             glBindBuffer(GL_ARRAY_BUFFER, 0);
 
         // terrain debug
@@ -4348,7 +4353,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
             glBindVertexArray(bspVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numBSPverts[unit]));
+            glDrawElements(GL_TRIANGLES, bspgeometry.drawList(unit).size(), GL_UNSIGNED_INT, 0);
             drawcalls++;
             //}
         }
@@ -4907,14 +4912,15 @@ void OpenGLRenderer::ReleaseTerrain() {
         outbuildtexturewidths[i] = 0;
         outbuildtextureheights[i] = 0;
         glDeleteBuffers(1, &outbuildVBO[i]);
+        glDeleteBuffers(1, &outbuildEBO[i]);
         glDeleteVertexArrays(1, &outbuildVAO[i]);
         outbuildVBO[i] = 0;
+        outbuildEBO[i] = 0;
         outbuildVAO[i] = 0;
-        if (outbuildshaderstore[i]) {
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-        }
     }
+
+    outbuildgeometry.clear();
+    outbuildfaceoffsets.clear();
 }
 
 void OpenGLRenderer::ReleaseBSP() {
@@ -4934,14 +4940,23 @@ void OpenGLRenderer::ReleaseBSP() {
         bsptexturewidths[i] = 0;
         bsptextureheights[i] = 0;
         glDeleteBuffers(1, &bspVBO[i]);
+        glDeleteBuffers(1, &bspEBO[i]);
         glDeleteVertexArrays(1, &bspVAO[i]);
         bspVAO[i] = 0;
         bspVBO[i] = 0;
-        if (BSPshaderstore[i]) {
-            free(BSPshaderstore[i]);
-            BSPshaderstore[i] = nullptr;
-        }
+        bspEBO[i] = 0;
     }
+
+    bspgeometry.clear();
+}
+
+void OpenGLRenderer::invalidateIndoorFaceGeometry(std::span<const int16_t> faceIds) {
+    for (int16_t faceId : faceIds)
+        bspgeometry.invalidate(faceId);
+}
+
+GeometryCacheStats OpenGLRenderer::geometryCacheStats() const {
+    return uCurrentlyLoadedLevelType == LEVEL_INDOOR ? bspgeometry.frameStats() : outbuildgeometry.frameStats();
 }
 
 
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <span>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: this is not a C system include.
 #include <glm/glm.hpp>
@@ -11,6 +13,7 @@
 #include "BaseRenderer.h"
 
 #include "Library/Color/Colorf.h"
+#include "Library/GeometryCache/GeometryCache.h"
 
 #include "OpenGLShader.h"
 
@@ -97,6 +100,9 @@ class OpenGLRenderer : public BaseRenderer {
     virtual void ReleaseTerrain() override;
     virtual void ReleaseBSP() override;
 
+    virtual void invalidateIndoorFaceGeometry(std::span<const int16_t> faceIds) override;
+    virtual GeometryCacheStats geometryCacheStats() const override;
+
     virtual void DrawTwodVerts() override;
     void DrawBillboards();
 
@@ -161,20 +167,23 @@ class OpenGLRenderer : public BaseRenderer {
     std::map<std::string, int> terraintexmap;
 
     // outside building shader
-    GLuint outbuildVBO[16]{}, outbuildVAO[16]{};
+    GLuint outbuildVBO[16]{}, outbuildVAO[16]{}, outbuildEBO[16]{};
     GLuint outbuildtextures[16]{};
     unsigned int numoutbuildtexloaded[16]{};
     unsigned int outbuildtexturewidths[16]{};
     unsigned int outbuildtextureheights[16]{};
     std::map<std::string, int> outbuildtexmap;
+    GeometryCache outbuildgeometry;
+    std::vector<int> outbuildfaceoffsets; // First `outbuildgeometry` face id for each model in `pOutdoor->pBModels`.
 
     // indoors bsp shader
-    GLuint bspVBO[16]{}, bspVAO[16]{};
+    GLuint bspVBO[16]{}, bspVAO[16]{}, bspEBO[16]{};
     GLuint bsptextures[16]{};
     unsigned int bsptexloaded[16]{};
     unsigned int bsptexturewidths[16]{};
     unsigned int bsptextureheights[16]{};
     std::map<std::string, int> bsptexmap;
+    GeometryCache bspgeometry; // Face ids are indices into `pIndoor->pFaces`.
 
     // text shader
     GLuint textVBO{}, textVAO{};
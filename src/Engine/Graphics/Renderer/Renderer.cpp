@@ -1,6 +1,8 @@
 #include "Renderer.h"
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 Renderer *render = nullptr;
 
@@ -19,9 +21,42 @@ Renderer::Renderer(
 
     uFogColor = Color();
     hd_water_current_frame = 0;
-    memset(pBillboardRenderListD3D, 0, sizeof(pBillboardRenderListD3D));
-    uNumBillboardsToDraw = 0;
     drawcalls = 0;
 }
 
 Renderer::~Renderer() = default;
+
+RenderBillboardD3D *Renderer::addBillboardD3D() {
+    return &pBillboardRenderListD3D.emplace_back();
+}
+
+void Renderer::sortBillboardsD3D() {
+    size_t size = pBillboardRenderListD3D.size();
+    if (_sortedBillboardCount == size)
+        return;
+
+    // Billboards that are already sorted keep their relative order. New billboards go in front of the old ones with
+    // the same z order, most recently added first. This makes all keys unique, so we can use a non-stable sort.
+    _billboardSortKeys.clear();
+    for (size_t i = 0; i < size; i++) {
+        int order = i < _sortedBillboardCount ? static_cast<int>(i) : -static_cast<int>(i) - 1;
+        _billboardSortKeys.push_back({pBillboardRenderListD3D[i].z_order, order, static_cast<int>(i)});
+    }
+
+    std::sort(_billboardSortKeys.begin(), _billboardSortKeys.end(), [] (const auto &l, const auto &r) {
+        if (l.zOrder != r.zOrder)
+            return l.zOrder < r.zOrder;
+        return l.order < r.order;
+    });
+
+    _billboardSortBuffer.clear();
+    for (const BillboardSortKey &key : _billboardSortKeys)
+        _billboardSortBuffer.push_back(pBillboardRenderListD3D[key.index]);
+    std::swap(pBillboardRenderListD3D, _billboardSortBuffer);
+    _sortedBillboardCount = size;
+}
+
+void Renderer::clearBillboardsD3D() {
+    pBillboardRenderListD3D.clear();
+    _sortedBillboardCount = 0;
+}
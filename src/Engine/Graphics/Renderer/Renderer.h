@@ -1,12 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "Library/Image/Image.h"
 #include "Library/Color/Color.h"
 #include "Library/Color/ColorTable.h"
 #include "Library/Geometry/Rect.h"
+#include "Library/GeometryCache/GeometryCacheStats.h"
 #include "Engine/HitMap.h"
 
 #include "TextureRenderId.h"
@@ -156,6 +159,19 @@ class Renderer {
     virtual void ReleaseTerrain() = 0;
     virtual void ReleaseBSP() = 0;
 
+    /**
+     * Marks cached geometry of the given indoor faces as out of date. Should be called whenever face vertices or
+     * texture coordinates are changed in place, e.g. when doors move.
+     *
+     * @param faceIds                   Indices into `pIndoor->pFaces`.
+     */
+    virtual void invalidateIndoorFaceGeometry(std::span<const int16_t> faceIds) = 0;
+
+    /**
+     * @return                          Map geometry upload counters for the last drawn frame.
+     */
+    virtual GeometryCacheStats geometryCacheStats() const = 0;
+
     virtual void DrawTwodVerts() = 0;
 
     virtual Sizei GetRenderDimensions() = 0;
@@ -176,9 +192,31 @@ class Renderer {
     Color uFogColor;
     int hd_water_current_frame;
     GraphicsImage *hd_water_tile_anim[7];
-    RenderBillboardD3D pBillboardRenderListD3D[1000];
-    unsigned int uNumBillboardsToDraw; // TODO(captainurist): this is not properly cleared if BeginScene3D is not called,
-                                       //                     resulting in dangling textures in pBillboardRenderListD3D.
+    /**
+     * Appends a billboard to `pBillboardRenderListD3D`. The returned billboard should be filled in right away,
+     * including its `z_order`. It stays valid only until the next billboard is added.
+     *
+     * Billboards are not sorted on insertion, call `sortBillboardsD3D` to sort them.
+     */
+    RenderBillboardD3D *addBillboardD3D();
+
+    /**
+     * Sorts `pBillboardRenderListD3D` by `z_order`, front to back. Billboards with the same `z_order` are ordered
+     * from the most recently added one. This matches what the original insertion sort did, and matters as the order
+     * leaks into game logic through `getActorsInViewport`.
+     *
+     * Does nothing if no billboards were added since the last call. Must be called before billboards are consumed.
+     */
+    void sortBillboardsD3D();
+
+    /**
+     * Clears `pBillboardRenderListD3D`, keeping the allocated memory for the next frame.
+     */
+    void clearBillboardsD3D();
+
+    std::vector<RenderBillboardD3D> pBillboardRenderListD3D; // TODO(captainurist): this is not properly cleared if
+                                                             // BeginScene3D is not called, resulting in dangling
+                                                             // textures.
 
     int drawcalls;
 
@@ -186,13 +224,23 @@ class Renderer {
     SpellFxRenderer *spell_fx_renderer = nullptr;
     std::shared_ptr<ParticleEngine> particle_engine = nullptr;
     Vis *vis = nullptr;
+
+ private:
+    struct BillboardSortKey {
+        float zOrder;
+        int order; // Tie breaker for equal zOrder.
+        int index; // Index in pBillboardRenderListD3D.
+    };
+
+    size_t _sortedBillboardCount = 0;
+    std::vector<BillboardSortKey> _billboardSortKeys; // Reused between frames.
+    std::vector<RenderBillboardD3D> _billboardSortBuffer; // Reused between frames.
 };
 
 extern Renderer *render;
 
 extern int uNumDecorationsDrawnThisFrame;
-extern RenderBillboard pBillboardRenderList[500];
-extern unsigned int uNumBillboardsToDraw;
+extern std::vector<RenderBillboard> pBillboardRenderList;
 extern int uNumSpritesDrawnThisFrame;
 
 extern RenderVertexSoft VertexRenderList[50];
@@ -15,13 +15,12 @@
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
 
-#include "Utility/String/Ascii.h"
+#include "Utility/MapAccess.h"
 
 SpriteFrameTable *pSpriteFrameTable;
 
 void Sprite::Release() {
-    delete this->sprite_header;
-    this->sprite_header = nullptr;
+    this->sprite_header.reset();
     this->texture->Release();
     this->texture = nullptr;
     this->pName = "null";
@@ -166,15 +165,19 @@ void SpriteFrameTable::InitializeSprite(signed int uSpriteID) {
 
 //----- (0044D813) --------------------------------------------------------
 int SpriteFrameTable::FastFindSprite(std::string_view pSpriteName) {
-    auto cmp = [this] (uint16_t index, std::string_view name) {
-        return ascii::noCaseLess(pSpriteSFrames[index].icon_name, name);
-    };
+    return FastFindSprite(NameAtom(pSpriteName));
+}
 
-    auto pos = std::lower_bound(pSpriteEFrames.begin(), pSpriteEFrames.end(), pSpriteName, cmp);
-    if (pos == pSpriteEFrames.end())
-        return 0;
+int SpriteFrameTable::FastFindSprite(NameAtom spriteName) {
+    return valueOr(_spriteIdByName, spriteName, 0);
+}
 
-    return ascii::noCaseEquals(pSpriteSFrames[*pos].icon_name, pSpriteName) ? *pos : 0;
+void SpriteFrameTable::rebuildNameIndex() {
+    // `pSpriteEFrames` is sorted by name, so for duplicate names the first one wins. This is what the original
+    // binary search was returning.
+    _spriteIdByName.clear();
+    for (uint16_t index : pSpriteEFrames)
+        _spriteIdByName.emplace(NameAtom(pSpriteSFrames[index].icon_name), index);
 }
 
 //----- (0044D8D0) --------------------------------------------------------
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Time/Duration.h"
 
+#include "Utility/String/NameAtom.h"
+
 struct DecorationDesc;
 class GraphicsImage;
 struct LodSprite;
@@ -20,7 +25,7 @@ class Sprite {
     int uAreaY = 0; // TODO(captainurist): was intended to support sprite maps?
     int uWidth = 0; // Same as texture->width().
     int uHeight = 0;
-    LodSprite *sprite_header = nullptr;
+    std::shared_ptr<const LodSprite> sprite_header;
 };
 
 class SpriteFrame {
@@ -58,6 +63,7 @@ struct SpriteFrameTable {
      *                                  Conveniently, sprite 0 is a dummy sprite that actually exists.
      */
     int FastFindSprite(std::string_view pSpriteName);
+    int FastFindSprite(NameAtom spriteName);
     SpriteFrame *GetFrame(int uSpriteID, Duration uTime);
     SpriteFrame *GetFrameReversed(int uSpriteID, Duration time);
 
@@ -71,6 +77,14 @@ struct SpriteFrameTable {
     /** Indices into `pSpriteSFrames`, sorted by sprite name. Note that `pSpriteSFrames` itself is not sorted.
      * Contains only indices for 'a' (frontal?) sprites, so smaller in size than `pSpriteSFrames`. */
     std::vector<uint16_t> pSpriteEFrames;
+
+    /**
+     * Rebuilds the name index used by `FastFindSprite`. Must be called after `pSpriteEFrames` was changed.
+     */
+    void rebuildNameIndex();
+
+ private:
+    std::unordered_map<NameAtom, int> _spriteIdByName;
 };
 
 extern SpriteFrameTable *pSpriteFrameTable;
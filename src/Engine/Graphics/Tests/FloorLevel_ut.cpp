@@ -0,0 +1,94 @@
+#include <chrono>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Application/GameConfig.h"
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Engine.h"
+#include "Engine/Party.h"
+
+#include "Utility/String/Format.h"
+
+// These are timing tests for the floor level lookups, which are called per actor & per sprite object every frame.
+// They don't check the timings, just print them out, and check that repeated lookups return the same results.
+
+static constexpr int GRID_RADIUS = 1024;
+static constexpr int GRID_STEP = 64;
+static constexpr int ITERATIONS = 100;
+
+static std::vector<Vec3f> floorLevelGrid() {
+    std::vector<Vec3f> result;
+    for (int dx = -GRID_RADIUS; dx <= GRID_RADIUS; dx += GRID_STEP)
+        for (int dy = -GRID_RADIUS; dy <= GRID_RADIUS; dy += GRID_STEP)
+            result.push_back(pParty->pos + Vec3f(dx, dy, 0));
+    return result;
+}
+
+template<class Callable>
+static void timeFloorLevel(std::string_view name, int count, Callable &&callable) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+        callable();
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    int lookups = count * ITERATIONS;
+    fmt::print(stdout, "{}: {} lookups, {:.1f}ns per lookup\n", name, lookups, elapsed / lookups);
+}
+
+GAME_TEST(FloorLevel, Indoor) {
+    test.loadGameFromTestData("issue_1997.mm7"); // Temple of Baa.
+    ASSERT_EQ(uCurrentlyLoadedLevelType, LEVEL_INDOOR);
+
+    // Slack is read from a bound copy of the config value.
+    engine->config->gameplay.FloorChecksEps.setValue(5);
+    EXPECT_EQ(engine->config->hot.floorChecksEps, 5);
+    engine->config->gameplay.FloorChecksEps.reset();
+    EXPECT_EQ(engine->config->hot.floorChecksEps, engine->config->gameplay.FloorChecksEps.defaultValue());
+
+    std::vector<Vec3f> points;
+    std::vector<int> sectors;
+    for (const Vec3f &pos : floorLevelGrid()) {
+        int sector = pIndoor->GetSector(pos);
+        if (sector == 0)
+            continue;
+        points.push_back(pos);
+        sectors.push_back(sector);
+    }
+    ASSERT_FALSE(points.empty());
+
+    std::vector<float> levels;
+    for (size_t i = 0; i < points.size(); i++)
+        levels.push_back(BLV_GetFloorLevel(points[i], sectors[i]));
+
+    int mismatches = 0;
+    timeFloorLevel("BLV_GetFloorLevel", points.size(), [&] {
+        for (size_t i = 0; i < points.size(); i++)
+            mismatches += BLV_GetFloorLevel(points[i], sectors[i]) != levels[i];
+    });
+    EXPECT_EQ(mismatches, 0);
+}
+
+GAME_TEST(FloorLevel, Outdoor) {
+    game.startNewGame(); // Emerald Island.
+    ASSERT_EQ(uCurrentlyLoadedLevelType, LEVEL_OUTDOOR);
+
+    std::vector<Vec3f> points = floorLevelGrid();
+    std::vector<float> levels;
+    for (const Vec3f &pos : points) {
+        bool onWater = false;
+        int faceId = 0;
+        levels.push_back(ODM_GetFloorLevel(pos, &onWater, &faceId));
+    }
+
+    int mismatches = 0;
+    timeFloorLevel("ODM_GetFloorLevel", points.size(), [&] {
+        for (size_t i = 0; i < points.size(); i++) {
+            bool onWater = false;
+            int faceId = 0;
+            mismatches += ODM_GetFloorLevel(points[i], &onWater, &faceId) != levels[i];
+        }
+    });
+    EXPECT_EQ(mismatches, 0);
+}
@@ -5,7 +5,7 @@
 #include "Engine/AssetsManager.h"
 
 #include "Library/Logger/Logger.h"
-#include "Utility/String/Ascii.h"
+#include "Utility/MapAccess.h"
 
 TextureFrameTable *pTextureFrameTable;
 
@@ -17,12 +17,18 @@ GraphicsImage *TextureFrame::GetTexture() {
 }
 
 int64_t TextureFrameTable::FindTextureByName(std::string_view Str2) {
-    std::string name = ascii::toLower(Str2);
+    return FindTextureByName(NameAtom(Str2));
+}
+
+int64_t TextureFrameTable::FindTextureByName(NameAtom name) {
+    return valueOr(_textureIdByName, name, -1);
+}
 
+void TextureFrameTable::rebuildNameIndex() {
+    // For duplicate names the first one wins.
+    _textureIdByName.clear();
     for (size_t i = 0; i < textures.size(); ++i)
-        if (textures[i].name == name)
-            return i;
-    return -1;
+        _textureIdByName.emplace(NameAtom(textures[i].name), i);
 }
 
 GraphicsImage *TextureFrameTable::GetFrameTexture(int64_t frameId, Duration offset) {
@@ -2,12 +2,15 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Data/FrameEnums.h"
 #include "Engine/Time/Duration.h"
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/String/NameAtom.h"
 
 class GraphicsImage;
 
@@ -41,8 +44,17 @@ struct TextureFrameTable {
     Duration textureFrameAnimTime(int64_t frameID);
 
     int64_t FindTextureByName(std::string_view Str2);
+    int64_t FindTextureByName(NameAtom name);
+
+    /**
+     * Rebuilds the name index used by `FindTextureByName`. Must be called after `textures` was changed.
+     */
+    void rebuildNameIndex();
 
     std::vector<TextureFrame> textures;
+
+ private:
+    std::unordered_map<NameAtom, int64_t> _textureIdByName;
 };
 
 extern TextureFrameTable *pTextureFrameTable;
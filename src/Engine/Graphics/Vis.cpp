@@ -132,7 +132,8 @@ bool Vis::IsPolygonOccludedByBillboard(RenderVertexSoft *vertices,
     // v5 = 0;
 
     // v6 = render->pBillboardRenderListD3D;
-    for (unsigned i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    render->sortBillboardsD3D();
+    for (unsigned i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *billboard = &render->pBillboardRenderListD3D[i];
         if (IsPointInsideD3DBillboard(billboard, x, y)) {
             if (v13 == -1)
@@ -226,7 +227,8 @@ void Vis::GetPolygonScreenSpaceCenter(RenderVertexSoft *vertices,
 void Vis::PickBillboards_Mouse(float fPickDepth, float fX, float fY,
                                Vis_SelectionList *list,
                                Vis_SelectionFilter *filter) {
-    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    render->sortBillboardsD3D();
+    for (int i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *d3d_billboard = &render->pBillboardRenderListD3D[i];
         if (isBillboardPartOfSelection(i, filter) && IsPointInsideD3DBillboard(d3d_billboard, fX, fY)) {
             if (DoesRayIntersectBillboard(fPickDepth, i)) {
@@ -361,35 +363,44 @@ void Vis::PickOutdoorFaces_Mouse(float fDepth, const Vec3f &rayOrigin, const Vec
                                  bool only_reachable) {
     if (!pOutdoor) return;
 
-    for (BSPModel &model : pOutdoor->pBModels) {
-        bool reachable;
-        if (!IsBModelVisible(&model, fDepth, &reachable)) {
-            continue;
+    // clear the debug attribute
+    for (BSPModel &model : pOutdoor->pBModels)
+        for (ODMFace &face : model.pFaces)
+            face.uAttributes &= ~FACE_OUTLINED;
+
+    static std::vector<OutdoorFaceRef> faces; // Static so that we don't reallocate on every call.
+    pOutdoor->faceGrid.facesAlong(rayOrigin, rayOrigin + rayStep, &faces);
+
+    int lastModelId = -1;
+    bool modelPickable = false;
+    for (OutdoorFaceRef ref : faces) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
+        if (lastModelId != ref.modelId) {
+            lastModelId = ref.modelId;
+
+            bool reachable;
+            modelPickable = IsBModelVisible(&model, fDepth, &reachable) && (reachable || !only_reachable);
         }
-        if (!reachable && only_reachable) {
+        if (!modelPickable)
             continue;
-        }
 
-        for (ODMFace &face : model.pFaces) {
-            face.uAttributes &= ~FACE_OUTLINED;
+        ODMFace &face = model.pFaces[ref.faceId];
+        if (isFacePartOfSelection(&face, nullptr, filter)) {
+            BLVFace blv_face;
+            blv_face.FromODM(&face);
+
+            RenderVertexSoft intersection;
+            if (Intersect_Ray_Face(rayOrigin, rayStep, &intersection,
+                                   &blv_face, model.index)) {
+                pCamera3D->ViewTransform(&intersection, 1);
+                // int v13 = fixpoint_from_float(/*v12,
+                // */intersection.vWorldViewPosition.x); v13 &= 0xFFFF0000;
+                // v13 += Pid(OBJECT_Face, j | (i << 6));
+                Pid pid = Pid(OBJECT_Face, face.index | (model.index << 6));
+                list->AddObject(VisObjectType_Face, intersection.vWorldViewPosition.x, pid);
 
-            if (isFacePartOfSelection(&face, nullptr, filter)) {
-                BLVFace blv_face;
-                blv_face.FromODM(&face);
-
-                RenderVertexSoft intersection;
-                if (Intersect_Ray_Face(rayOrigin, rayStep, &intersection,
-                                       &blv_face, model.index)) {
-                    pCamera3D->ViewTransform(&intersection, 1);
-                    // int v13 = fixpoint_from_float(/*v12,
-                    // */intersection.vWorldViewPosition.x); v13 &= 0xFFFF0000;
-                    // v13 += Pid(OBJECT_Face, j | (i << 6));
-                    Pid pid = Pid(OBJECT_Face, face.index | (model.index << 6));
-                    list->AddObject(VisObjectType_Face, intersection.vWorldViewPosition.x, pid);
-
-                    if (engine->config->debug.ShowPickedFace.value())
-                        face.uAttributes |= FACE_OUTLINED;
-                }
+                if (engine->config->debug.ShowPickedFace.value())
+                    face.uAttributes |= FACE_OUTLINED;
             }
         }
     }
@@ -724,7 +735,8 @@ Vis_PIDAndDepth Vis::PickMouse(float fDepth, float fMouseX, float fMouseY,
 //----- (004C06F8) --------------------------------------------------------
 void Vis::PickBillboards_Keyboard(float pick_depth, Vis_SelectionList *list,
                                   Vis_SelectionFilter *filter) {
-    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    render->sortBillboardsD3D();
+    for (int i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *d3d_billboard = &render->pBillboardRenderListD3D[i];
 
         if (isBillboardPartOfSelection(i, filter)) {
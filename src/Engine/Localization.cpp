@@ -37,11 +37,11 @@ bool Localization::Initialize() {
         return false;
     }
 
-    strtok(this->localization_raw.data(), "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(this->localization_raw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
 
     for (LstrId i : Segment(LSTR_FIRST_MM7, LSTR_LAST_MM7)) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = threadSafeStrtok(NULL, "\r") + 1;
         step = 0;
         string_end = false;
         do {
@@ -335,9 +335,9 @@ void Localization::InitializeSkillNames() {
     //    "So don't expect to become thwonking killer and devastating anyone beyond weaklings.";
 
     skill_desc_raw = engine->_gameResourceManager->getEventsFile("skilldes.txt").string_view();
-    strtok(skill_desc_raw.data(), "\r");
+    threadSafeStrtok(skill_desc_raw.data(), "\r");
     for (Skill i : allVisibleSkills()) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = threadSafeStrtok(NULL, "\r") + 1;
 
         if (test_string != NULL && strlen(test_string) > 0) {
             auto tokens = tokenize(test_string, '\t');
@@ -399,9 +399,9 @@ void Localization::InitializeClassNames() {
     this->class_names[CLASS_LICH] = this->localization_strings[LSTR_LICH];
 
     this->class_desc_raw = engine->_gameResourceManager->getEventsFile("class.txt").string_view();
-    strtok(this->class_desc_raw.data(), "\r");
+    threadSafeStrtok(this->class_desc_raw.data(), "\r");
     for (Class i : class_desciptions.indices()) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(test_string, '\t');
         assert(tokens.size() == 3 && "Invalid number of tokens");
         class_desciptions[i] = removeQuotes(tokens[1]);
@@ -477,9 +477,9 @@ void Localization::InitializeAttributeNames() {
     this->attribute_names[ATTRIBUTE_LUCK]         = this->localization_strings[LSTR_LUCK];
 
     this->attribute_desc_raw = engine->_gameResourceManager->getEventsFile("stats.txt").string_view();
-    strtok(this->attribute_desc_raw.data(), "\r");
+    threadSafeStrtok(this->attribute_desc_raw.data(), "\r");
     for (int i = 0; i < 26; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = threadSafeStrtok(NULL, "\r") + 1;
         std::vector<std::string_view> tokens = split(test_string, '\t');
         assert(tokens.size() == 2 && "Invalid number of tokens");
         switch (i) {
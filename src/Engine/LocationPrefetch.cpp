@@ -0,0 +1,161 @@
+#include "LocationPrefetch.h"
+
+#include <array>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "Engine/Snapshots/CompositeSnapshots.h"
+
+#include "Library/Logger/Logger.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodFormats.h"
+#include "Library/Snapshots/CommonSnapshots.h"
+
+#include "Utility/String/Ascii.h"
+
+#include "LOD.h"
+#include "LodRegistry.h"
+
+namespace {
+
+struct PrefetchedLocation {
+    std::variant<std::monostate, IndoorLocation_MM7, OutdoorLocation_MM7> location;
+    std::vector<std::pair<std::string, LodImage>> textures; // Decoded face textures, keyed by lowercase name.
+};
+
+struct PendingPrefetch {
+    std::string mapFileName; // Lowercase.
+    const LodReader *bitmaps = nullptr;
+    std::future<PrefetchedLocation> result;
+};
+
+} // namespace
+
+static std::optional<PendingPrefetch> pendingPrefetch;
+
+template<size_t N>
+static void collectTextureNames(const std::vector<std::array<char, N>> &src, std::unordered_set<std::string> *dst) {
+    std::string name;
+    for (const std::array<char, N> &textureName : src) {
+        reconstruct(textureName, &name);
+        if (!name.empty())
+            dst->insert(ascii::toLower(name));
+    }
+}
+
+static PrefetchedLocation PrefetchLocationData(const LodReader *games, const LodReader *bitmaps,
+                                               const std::string &mapFileName) {
+    PrefetchedLocation result;
+    std::unordered_set<std::string> textureNames;
+
+    Blob mapFile = lod::decodeCompressed(games->read(mapFileName));
+    if (mapFileName.ends_with(".blv")) {
+        IndoorLocation_MM7 &location = result.location.emplace<IndoorLocation_MM7>();
+        deserialize(mapFile, &location);
+        collectTextureNames(location.faceTextures, &textureNames);
+        collectTextureNames(location.faceExtraTextures, &textureNames);
+    } else {
+        OutdoorLocation_MM7 &location = result.location.emplace<OutdoorLocation_MM7>();
+        deserialize(mapFile, &location);
+        for (const BSPModelExtras_MM7 &model : location.modelExtras)
+            collectTextureNames(model.faceTextures, &textureNames);
+    }
+
+    // Animated textures are named after their texture frame table entries, so not all names will be found here.
+    // That's OK, these are loaded on the game thread as usual.
+    for (const std::string &name : textureNames)
+        if (bitmaps->exists(name))
+            result.textures.emplace_back(name, lod::decodeImage(bitmaps->read(name)));
+
+    return result;
+}
+
+template<class Location>
+static bool TakePrefetchedLocationInternal(std::string_view mapFileName, Location *location) {
+    if (!pendingPrefetch)
+        return false;
+
+    if (!ascii::noCaseEquals(pendingPrefetch->mapFileName, mapFileName)) {
+        CancelLocationPrefetch();
+        return false;
+    }
+
+    PendingPrefetch prefetch = std::move(*pendingPrefetch);
+    pendingPrefetch.reset();
+
+    PrefetchedLocation data;
+    try {
+        data = prefetch.result.get();
+    } catch (const std::exception &e) {
+        logger->warning("Failed to prefetch location '{}', loading it synchronously: {}",
+                        prefetch.mapFileName, e.what());
+        return false;
+    }
+
+    Location *prefetched = std::get_if<Location>(&data.location);
+    if (!prefetched)
+        return false;
+
+    // Hand decoded textures over to the asset cache, `LodTextureCache` will then find them there.
+    for (auto &[name, image] : data.textures) {
+        (void) pLodRegistry->assets()->decode<LodImage>(
+            prefetch.bitmaps->read(name),
+            [&image] (const Blob &) { return std::move(image); },
+            [] (const LodImage &cached) { return sizeof(LodImage) + cached.image.pixels().size_bytes(); });
+    }
+
+    *location = std::move(*prefetched);
+    logger->debug("Using prefetched location '{}' with {} textures", prefetch.mapFileName, data.textures.size());
+    return true;
+}
+
+void PrefetchLocation(std::string_view mapFileName) {
+    std::string name = ascii::toLower(mapFileName);
+    if (!name.ends_with(".blv") && !name.ends_with(".odm"))
+        return;
+
+    if (pendingPrefetch) {
+        if (pendingPrefetch->mapFileName == name)
+            return;
+
+        // Don't block the game thread waiting for an unrelated prefetch.
+        if (pendingPrefetch->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return;
+    }
+
+    const LodReader *games = pGames_LOD.get();
+    if (!games || !games->exists(name))
+        return;
+
+    // Readers are resolved here as `pGames_LOD` and the LOD registry are only ever written to on the game thread.
+    const LodReader *bitmaps = pLodRegistry->open("data/bitmaps.lod");
+
+    pendingPrefetch.emplace();
+    pendingPrefetch->mapFileName = name;
+    pendingPrefetch->bitmaps = bitmaps;
+    pendingPrefetch->result = std::async(std::launch::async, [games, bitmaps, name] {
+        return PrefetchLocationData(games, bitmaps, name);
+    });
+}
+
+bool TakePrefetchedLocation(std::string_view mapFileName, IndoorLocation_MM7 *location) {
+    return TakePrefetchedLocationInternal(mapFileName, location);
+}
+
+bool TakePrefetchedLocation(std::string_view mapFileName, OutdoorLocation_MM7 *location) {
+    return TakePrefetchedLocationInternal(mapFileName, location);
+}
+
+void CancelLocationPrefetch() {
+    if (!pendingPrefetch)
+        return;
+
+    pendingPrefetch->result.wait();
+    pendingPrefetch.reset();
+}
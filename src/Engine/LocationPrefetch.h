@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string_view>
+
+struct IndoorLocation_MM7;
+struct OutdoorLocation_MM7;
+
+/**
+ * Starts loading the given location on a worker thread, so that the actual location change doesn't have to wait for
+ * it. The map file is read from `pGames_LOD`, decompressed and deserialized, and the textures of the map's faces are
+ * decoded from `data/bitmaps.lod`.
+ *
+ * Only one location is prefetched at a time. Does nothing if the location is already being prefetched, or if another
+ * prefetch is still running.
+ *
+ * Prefetching doesn't touch any game state, so it's invisible to the game logic and doesn't affect determinism.
+ *
+ * Must be called on the game thread.
+ *
+ * @param mapFileName                   Name of the map file, e.g. "out01.odm" or "d01.blv".
+ */
+void PrefetchLocation(std::string_view mapFileName);
+
+/**
+ * Takes over the results of `PrefetchLocation`, waiting for it to complete if needed. Decoded textures are moved into
+ * the LOD asset cache, so that they are picked up by `LodTextureCache`.
+ *
+ * If the requested map wasn't prefetched, or if prefetching has failed, returns `false` and leaves `location`
+ * untouched, and the caller is expected to load the map itself.
+ *
+ * Must be called on the game thread.
+ *
+ * @param mapFileName                   Name of the map file, e.g. "d01.blv".
+ * @param[out] location                 Deserialized map.
+ * @return                              Whether the map was taken from the prefetched data.
+ */
+bool TakePrefetchedLocation(std::string_view mapFileName, IndoorLocation_MM7 *location);
+bool TakePrefetchedLocation(std::string_view mapFileName, OutdoorLocation_MM7 *location);
+
+/**
+ * Waits for the running prefetch to complete, and drops its results. Does nothing if there is no prefetch running.
+ *
+ * Must be called on the game thread.
+ */
+void CancelLocationPrefetch();
@@ -0,0 +1,31 @@
+#include "LodRegistry.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Utility/MapAccess.h"
+
+#include "EngineFileSystem.h"
+
+static constexpr size_t LOD_ASSET_CACHE_BUDGET = 64 * 1024 * 1024;
+
+LodRegistry *pLodRegistry = new LodRegistry;
+
+LodRegistry::LodRegistry() : _assets(LOD_ASSET_CACHE_BUDGET) {}
+
+LodRegistry::~LodRegistry() = default;
+
+const LodReader *LodRegistry::open(std::string_view path) {
+    std::lock_guard lock(_mutex);
+
+    std::string key(path);
+    if (const std::unique_ptr<LodReader> *reader = valuePtr(_readerByPath, key))
+        return reader->get();
+
+    // Data file system hands out memory-mapped blobs, so entries read from the LOD don't copy anything.
+    std::unique_ptr<LodReader> reader = std::make_unique<LodReader>(dfs->read(path));
+    const LodReader *result = reader.get();
+    _readerByPath.emplace(std::move(key), std::move(reader));
+    return result;
+}
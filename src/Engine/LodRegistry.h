@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Library/Lod/LodAssetCache.h"
+#include "Library/Lod/LodReader.h"
+
+/**
+ * Owner of all read-only LOD files used by the engine.
+ *
+ * Each LOD is opened only once, and stays open (and memory-mapped) until the registry is destroyed. This makes it
+ * possible to key decoded assets by the memory of the LOD entries they were decoded from, see `LodAssetCache`.
+ *
+ * Note that the save LOD is not managed here as it is rewritten on every save. See `pSave_LOD`.
+ *
+ * `open` is thread-safe, and so are the returned readers. Asset cache is not thread-safe.
+ */
+class LodRegistry {
+ public:
+    LodRegistry();
+    ~LodRegistry();
+
+    /**
+     * @param path                      Path to a LOD file in the data file system.
+     * @return                          Reader for the LOD file at the given path. Readers are never closed, so the
+     *                                  returned pointer stays valid for the lifetime of this registry.
+     * @throw Exception                 If the LOD couldn't be opened.
+     */
+    [[nodiscard]] const LodReader *open(std::string_view path);
+
+    /**
+     * @return                          Cache of assets decoded from the LOD files opened through this registry.
+     */
+    [[nodiscard]] LodAssetCache *assets() {
+        return &_assets;
+    }
+
+ private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<LodReader>> _readerByPath;
+    LodAssetCache _assets;
+};
+
+extern LodRegistry *pLodRegistry;
@@ -5,12 +5,14 @@
 #include <string>
 #include <memory>
 
+#include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
 
 #include "AssetsManager.h"
+#include "LodRegistry.h"
 
 LodSpriteCache *pSprites_LOD = nullptr;
 LodSpriteCache *pSprites_LOD_mm6 = nullptr;
@@ -23,9 +25,8 @@ LodSpriteCache::~LodSpriteCache() {
         sprite.Release();
 }
 
-bool LodSpriteCache::open(Blob blob) {
-    _reader.open(std::move(blob));
-    return true;
+void LodSpriteCache::open(const LodReader *reader) {
+    _reader = reader;
 }
 
 void LodSpriteCache::reserveLoadedSprites() {  // final init
@@ -48,24 +49,20 @@ Sprite *LodSpriteCache::loadSprite(std::string_view pContainerName) {
     if (result)
         return result;
 
-    std::unique_ptr<LodSprite> header = std::make_unique<LodSprite>();
-    if (!LoadSpriteFromFile(header.get(), name))
+    if (!_reader->exists(name))
         return nullptr;
 
+    std::shared_ptr<const LodSprite> header = pLodRegistry->assets()->decode<LodSprite>(
+        _reader->read(name),
+        [] (const Blob &entry) { return lod::decodeSprite(entry); },
+        [] (const LodSprite &sprite) { return sizeof(LodSprite) + sprite.image.pixels().size_bytes(); });
+
     Sprite &sprite = _spriteByName[name];
     sprite.pName = pContainerName;
     sprite.uWidth = header->image.width();
     sprite.uHeight = header->image.height();
     sprite.texture = assets->getSprite(pContainerName); // TODO(captainurist): very weird dependency here.
-    sprite.sprite_header = header.release();
+    sprite.sprite_header = std::move(header);
     _spritesInOrder.push_back(name);
     return &sprite;
 }
-
-bool LodSpriteCache::LoadSpriteFromFile(LodSprite *pSprite, std::string_view pContainer) {
-    if (!_reader.exists(pContainer))
-        return false;
-
-    *pSprite = lod::decodeSprite(_reader.read(pContainer));
-    return true;
-}
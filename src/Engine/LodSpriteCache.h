@@ -8,7 +8,6 @@
 #include "Engine/Graphics/Sprites.h"
 
 #include "Library/Image/Image.h"
-#include "Library/Lod/LodReader.h"
 
 class LodReader;
 struct LodSprite;
@@ -18,7 +17,11 @@ class LodSpriteCache {
     LodSpriteCache();
     ~LodSpriteCache();
 
-    bool open(Blob blob);
+    /**
+     * @param reader                    LOD reader to load sprites from, must be owned by `pLodRegistry`. Decoded
+     *                                  sprites are shared through the registry's asset cache.
+     */
+    void open(const LodReader *reader);
 
     void reserveLoadedSprites();
     void releaseUnreserved();
@@ -26,10 +29,7 @@ class LodSpriteCache {
     Sprite *loadSprite(std::string_view pContainerName);
 
  private:
-    bool LoadSpriteFromFile(LodSprite *pSprite, std::string_view pContainer);
-
- private:
-    LodReader _reader;
+    const LodReader *_reader = nullptr;
     int _reservedCount = 0;
     std::unordered_map<std::string, Sprite> _spriteByName;
     std::vector<std::string> _spritesInOrder;
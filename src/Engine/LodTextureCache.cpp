@@ -1,13 +1,18 @@
 #include "LodTextureCache.h"
 
+#include <memory>
 #include <utility>
 #include <string>
 
+#include "Library/Image/Pcx.h"
+#include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
 
+#include "LodRegistry.h"
+
 LodTextureCache *pIcons_LOD = nullptr;
 LodTextureCache *pIcons_LOD_mm6 = nullptr;
 LodTextureCache *pIcons_LOD_mm8 = nullptr;
@@ -19,8 +24,8 @@ LodTextureCache *pBitmaps_LOD_mm8 = nullptr;
 LodTextureCache::LodTextureCache() = default;
 LodTextureCache::~LodTextureCache() = default;
 
-void LodTextureCache::open(Blob blob) {
-    _reader.open(std::move(blob));
+void LodTextureCache::open(const LodReader *reader) {
+    _reader = reader;
 }
 
 void LodTextureCache::reserveLoadedTextures() {
@@ -28,6 +33,7 @@ void LodTextureCache::reserveLoadedTextures() {
 }
 
 void LodTextureCache::releaseUnreserved() {
+    // Note that the decoded images stay in the registry's asset cache, so reloading them later is cheap.
     while (_texturesInOrder.size() > _reservedCount) {
         const std::string &name = _texturesInOrder.back();
         _textureByName.erase(name);
@@ -35,19 +41,20 @@ void LodTextureCache::releaseUnreserved() {
     }
 }
 
-LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDummyOnError) {
+const LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDummyOnError) {
     std::string name = ascii::toLower(pContainer);
 
-    LodImage *result = valuePtr(_textureByName, name);
-    if (result)
-        return result;
+    if (const std::shared_ptr<const LodImage> *result = valuePtr(_textureByName, name))
+        return result->get();
 
-    result = &_textureByName[name];
-    if (LoadTextureFromLOD(result, name)) {
+    if (_reader->exists(name)) {
+        std::shared_ptr<const LodImage> result = pLodRegistry->assets()->decode<LodImage>(
+            _reader->read(name),
+            [] (const Blob &entry) { return lod::decodeImage(entry); },
+            [] (const LodImage &image) { return sizeof(LodImage) + image.image.pixels().size_bytes(); });
         _texturesInOrder.push_back(name);
-        return result;
+        return _textureByName.emplace(std::move(name), std::move(result)).first->second.get();
     }
-    _textureByName.erase(name);
 
     if (useDummyOnError) {
         return loadTexture("pending", false);
@@ -56,18 +63,20 @@ LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDumm
     }
 }
 
-Blob LodTextureCache::LoadCompressedTexture(std::string_view pContainer) {
-    return lod::decodeCompressed(_reader.read(pContainer));
-}
+std::shared_ptr<const RgbaImage> LodTextureCache::loadPcx(std::string_view pContainer) {
+    if (!_reader->exists(pContainer))
+        return nullptr;
 
-Blob LodTextureCache::read(std::string_view pContainer) {
-    return _reader.read(pContainer);
+    return pLodRegistry->assets()->decode<RgbaImage>(
+        _reader->read(pContainer),
+        [] (const Blob &entry) { return pcx::decode(lod::decodeCompressed(entry)); },
+        [] (const RgbaImage &image) { return image.pixels().size_bytes(); });
 }
 
-bool LodTextureCache::LoadTextureFromLOD(LodImage *pOutTex, std::string_view pContainer) {
-    if (!_reader.exists(pContainer))
-        return false;
+Blob LodTextureCache::LoadCompressedTexture(std::string_view pContainer) {
+    return lod::decodeCompressed(_reader->read(pContainer));
+}
 
-    *pOutTex = lod::decodeImage(_reader.read(pContainer));
-    return true;
+Blob LodTextureCache::read(std::string_view pContainer) {
+    return _reader->read(pContainer);
 }
@@ -5,7 +5,7 @@
 #include <unordered_map>
 #include <vector>
 
-#include "Library/Lod/LodReader.h"
+#include "Library/Image/Image.h"
 
 #include "Utility/Memory/Blob.h"
 
@@ -17,23 +17,31 @@ class LodTextureCache {
     LodTextureCache();
     ~LodTextureCache();
 
-    void open(Blob blob);
+    /**
+     * @param reader                    LOD reader to load textures from, must be owned by `pLodRegistry`. Decoded
+     *                                  textures are shared through the registry's asset cache.
+     */
+    void open(const LodReader *reader);
 
     void reserveLoadedTextures();
     void releaseUnreserved();
 
-    LodImage *loadTexture(std::string_view pContainer, bool useDummyOnError = true);
+    const LodImage *loadTexture(std::string_view pContainer, bool useDummyOnError = true);
+
+    /**
+     * @param pContainer                Name of a compressed PCX entry in this LOD.
+     * @return                          Decoded image, or `nullptr` if there is no such entry. Decoded images are
+     *                                  cached, so that reloading the same PCX doesn't hit the decoder again.
+     */
+    std::shared_ptr<const RgbaImage> loadPcx(std::string_view pContainer);
 
     Blob LoadCompressedTexture(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
     Blob read(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
 
  private:
-    bool LoadTextureFromLOD(LodImage *pOutTex, std::string_view pContainer);
-
- private:
-    LodReader _reader;
+    const LodReader *_reader = nullptr;
     int _reservedCount = 0;
-    std::unordered_map<std::string, LodImage> _textureByName;
+    std::unordered_map<std::string, std::shared_ptr<const LodImage>> _textureByName;
     std::vector<std::string> _texturesInOrder;
 };
 
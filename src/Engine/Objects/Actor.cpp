@@ -12,6 +12,7 @@
 #include "Engine/Data/HouseEnumFunctions.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/DecalBuilder.h"
+#include "Engine/Objects/ActorDistanceQueue.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
@@ -22,6 +23,7 @@
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
 #include "Engine/SpellFxRenderer.h"
@@ -2947,6 +2949,7 @@ void Actor::InitializeActors() {
             actor->pos.x = actor->initialPosition.x;
             actor->pos.y = actor->initialPosition.y;
             actor->pos.z = actor->initialPosition.z;
+            proximityIndex.invalidateActor(i);
             actor->currentHP = actor->monsterInfo.hp;
             if (actor->aiState != Disabled) {
                 Actor::AI_Stand(i, ai_near_actors_targets_pid[i],
@@ -3864,7 +3867,9 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
 
 //----- (004014E6) --------------------------------------------------------
 void Actor::MakeActorAIList_ODM() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
+    // Static so that we don't reallocate on every call.
+    static ActorDistanceQueue activeActors;
+    activeActors.clear();
 
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
@@ -3893,30 +3898,36 @@ void Actor::MakeActorAIList_ODM() {
                     pParty->SetRedAlert();
             }
             actor.attributes |= ACTOR_ACTIVE;
-            activeActorsDistances.push_back({actor.id, distance});
+            activeActors.push(actor.id, distance);
         } else {
             actor.ResetActive();
         }
     }
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
-
-    // and takes nearest amount
-    int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
-    for (int i = 0; (i < configLimit) && (i < activeActorsDistances.size()); i++) {
-        ai_near_actors_ids[i] = activeActorsDistances[i].first;
+    // take nearest amount, only these get sorted by distance
+    int configLimit = engine->config->hot.maxActiveAIActors;
+    for (int i = 0; (i < configLimit) && (i < activeActors.size()); i++) {
+        ai_near_actors_ids[i] = activeActors.at(i).actorId;
         pActors[ai_near_actors_ids[i]].attributes |= ACTOR_FULL_AI_STATE;
     }
 
-    ai_arrays_size = std::min(configLimit, (int)activeActorsDistances.size());
+    ai_arrays_size = std::min(configLimit, (int)activeActors.size());
 }
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-    std::vector<int> pickedActorIds;
+    // Static so that we don't reallocate on every call.
+    static ActorDistanceQueue activeActors;
+    static std::vector<int> pickedActorIds;
+    static std::vector<bool> isPicked;
+    activeActors.clear();
+    pickedActorIds.clear();
+    isPicked.assign(pActors.size(), false);
+
+    auto pickActor = [&](int actorId) {
+        pickedActorIds.push_back(actorId);
+        isPicked[actorId] = true;
+    };
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
@@ -3947,22 +3958,19 @@ int Actor::MakeActorAIList_BLV() {
                 if (!(pParty->GetYellowAlert()) && distance < 5120)
                     pParty->SetYellowAlert();
             }
-            activeActorsDistances.push_back({actor.id, distance});
+            activeActors.push(actor.id, distance);
         } else {
             // otherwise idle
             actor.ResetActive();
         }
     }
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
-
-    // checks nearby actors can detect player and take nearest 30
-    for (const auto &[actorId, _] : activeActorsDistances) {
+    // checks nearby actors can detect player and take nearest 30, actors are sorted by distance lazily
+    for (size_t i = 0; i < activeActors.size(); i++) {
+        int actorId = activeActors.at(i).actorId;
         if (pActors[actorId].ActorNearby() || Detect_Between_Objects(Pid(OBJECT_Actor, actorId), Pid(OBJECT_Character, 0))) {
             pActors[actorId].attributes |= ACTOR_NEARBY;
-            pickedActorIds.push_back(actorId);
+            pickActor(actorId);
             if (pickedActorIds.size() >= 30) {
                 break;
             }
@@ -3971,28 +3979,31 @@ int Actor::MakeActorAIList_BLV() {
 
     // add any actors than can act and are in the same sector
     for (int i = 0; i < pActors.size(); ++i) {
-        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&] (int id) { return id == i; });
-            if (found == pickedActorIds.end()) {
-                pActors[i].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(i);
-            }
+        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID && !isPicked[i]) {
+            pActors[i].attributes |= ACTOR_ACTIVE;
+            pickActor(i);
         }
     }
 
     // add any actors that are active and have previosuly detected the player
-    for (const auto &[actorId, _] : activeActorsDistances) {
-        if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct()) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&actorId = actorId] (int id) { return id == actorId; });
-            if (found == pickedActorIds.end()) {
-                pActors[actorId].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(actorId);
-            }
+    int configLimit = engine->config->hot.maxActiveAIActors;
+    auto addPreviouslyActive = [&](int actorId) {
+        if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct() &&
+            !isPicked[actorId]) {
+            pActors[actorId].attributes |= ACTOR_ACTIVE;
+            pickActor(actorId);
         }
-    }
+    };
+
+    // order only matters until the list is full, the rest of the actors can be processed unsorted
+    size_t index = 0;
+    for (; index < activeActors.size() && pickedActorIds.size() < configLimit; index++)
+        addPreviouslyActive(activeActors.at(index).actorId);
+    for (; index < activeActors.sortedSize(); index++)
+        addPreviouslyActive(activeActors.at(index).actorId);
+    activeActors.forEachUnsorted([&](const ActorDistanceQueue::Entry &entry) { addPreviouslyActive(entry.actorId); });
 
     // activate ai state for first x actors from list
-    int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
     for (int i = 0; (i < configLimit) && (i < pickedActorIds.size()); i++) {
         ai_near_actors_ids[i] = pickedActorIds[i];
         pActors[pickedActorIds[i]].attributes |= ACTOR_FULL_AI_STATE;
@@ -4003,69 +4014,16 @@ int Actor::MakeActorAIList_BLV() {
     return ai_arrays_size;
 }
 
-//----- (004070EF) --------------------------------------------------------
-bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
-    // get object 1 info
-    int obj1_pid = uObjID.id();
-    int obj1_sector;
-    Vec3f pos1;
-
-    switch (uObjID.type()) {
-        case OBJECT_Decoration:
-            pos1 = pLevelDecorations[obj1_pid].vPosition;
-            obj1_sector = pIndoor->GetSector(pos1);
-            break;
-        case OBJECT_Actor:
-            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
-            obj1_sector = pActors[obj1_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos1 = pSpriteObjects[obj1_pid].vPosition;
-            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get object 2 info
-    int obj2_pid = uObj2ID.id();
-    int obj2_sector;
-    Vec3f pos2;
-
-    switch (uObj2ID.type()) {
-        case OBJECT_Decoration:
-            pos2 = pLevelDecorations[obj2_pid].vPosition;
-            obj2_sector = pIndoor->GetSector(pos2);
-            break;
-        case OBJECT_Character:
-            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
-            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
-            break;
-        case OBJECT_Actor:
-            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
-            obj2_sector = pActors[obj2_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos2 = pSpriteObjects[obj2_pid].vPosition;
-            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get distance between objects
+/**
+ * Walks the portal graph along the ray from `pos1` to `pos2`.
+ *
+ * @return                              Whether the walk reaches `obj2_sector`.
+ */
+static bool detectThroughPortals(const Vec3f &pos1, int obj1_sector, const Vec3f &pos2, int obj2_sector) {
     float dist_x = pos2.x - pos1.x;
     float dist_y = pos2.y - pos1.y;
     float dist_z = pos2.z - pos1.z;
     float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
-    // range check
-    if (dist_3d > 5120) return 0;
-
-    // if in range always detected outdoors
-    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
-
-    // monster in same sector with player/ monster
-    if (obj1_sector == obj2_sector) return 1;
 
     // normalising
     float rayxnorm = dist_x / dist_3d;
@@ -4148,7 +4106,8 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
 
             // did we hit limit for portals?
             // does the next room have portals?
-            if (sectors_visited < 30 && pIndoor->pSectors[current_sector].uNumPortals > 0) {
+            if (sectors_visited < IndoorSectorVisibility::MAX_PORTAL_HOPS &&
+                pIndoor->pSectors[current_sector].uNumPortals > 0) {
                 current_portal = -1;
                 continue;
             } else {
@@ -4161,6 +4120,83 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     return 1;
 }
 
+//----- (004070EF) --------------------------------------------------------
+bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
+    // get object 1 info
+    int obj1_pid = uObjID.id();
+    int obj1_sector;
+    Vec3f pos1;
+
+    switch (uObjID.type()) {
+        case OBJECT_Decoration:
+            pos1 = pLevelDecorations[obj1_pid].vPosition;
+            obj1_sector = pIndoor->GetSector(pos1);
+            break;
+        case OBJECT_Actor:
+            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
+            obj1_sector = pActors[obj1_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos1 = pSpriteObjects[obj1_pid].vPosition;
+            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get object 2 info
+    int obj2_pid = uObj2ID.id();
+    int obj2_sector;
+    Vec3f pos2;
+
+    switch (uObj2ID.type()) {
+        case OBJECT_Decoration:
+            pos2 = pLevelDecorations[obj2_pid].vPosition;
+            obj2_sector = pIndoor->GetSector(pos2);
+            break;
+        case OBJECT_Character:
+            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
+            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
+            break;
+        case OBJECT_Actor:
+            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
+            obj2_sector = pActors[obj2_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos2 = pSpriteObjects[obj2_pid].vPosition;
+            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get distance between objects
+    float dist_x = pos2.x - pos1.x;
+    float dist_y = pos2.y - pos1.y;
+    float dist_z = pos2.z - pos1.z;
+    float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
+    // range check
+    if (dist_3d > 5120) return 0;
+
+    // if in range always detected outdoors
+    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
+
+    // monster in same sector with player/ monster
+    if (obj1_sector == obj2_sector) return 1;
+
+    // no portal path between the sectors
+    if (!pIndoor->sectorVisibility.mightSee(obj1_sector, obj2_sector)) return 0;
+
+    // portal walk result only depends on the inputs, so objects that didn't move can reuse it
+    IndoorSectorVisibility &visibility = pIndoor->sectorVisibility;
+    if (std::optional<bool> cached = visibility.cachedDetection(uObjID, uObj2ID, pos1, obj1_sector, pos2, obj2_sector))
+        return *cached;
+
+    bool result = detectThroughPortals(pos1, obj1_sector, pos2, obj2_sector);
+    visibility.cacheDetection(uObjID, uObj2ID, pos1, obj1_sector, pos2, obj2_sector, result);
+    return result;
+}
+
 //----- (0044FA4C) --------------------------------------------------------
 void Spawn_Light_Elemental(int spell_power, Mastery caster_skill_mastery, Duration duration) {
     // size_t uActorIndex;            // [sp+10h] [bp-10h]@6
@@ -4563,6 +4599,7 @@ Actor *AllocateActor(bool appendOnly) {
         for (size_t i = 0; i < pActors.size(); i++) {
             if (pActors[i].aiState == Removed) {
                 pActors[i].Reset();
+                proximityIndex.invalidateActor(i); // Will be placed somewhere else by the caller.
                 return &pActors[i];
             }
         }
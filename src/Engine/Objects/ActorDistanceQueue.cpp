@@ -0,0 +1,41 @@
+#include "ActorDistanceQueue.h"
+
+#include <cassert>
+#include <algorithm>
+
+// Heap comparator, puts the nearest actor on top.
+static bool isFarther(const ActorDistanceQueue::Entry &l, const ActorDistanceQueue::Entry &r) {
+    if (l.distance != r.distance)
+        return l.distance > r.distance;
+    return l.actorId > r.actorId;
+}
+
+void ActorDistanceQueue::clear() {
+    _sorted.clear();
+    _heap.clear();
+    _heapReady = false;
+}
+
+void ActorDistanceQueue::push(int actorId, int distance) {
+    assert(!_heapReady && _sorted.empty()); // Can't push after sorting has started.
+    assert(_heap.empty() || _heap.back().actorId < actorId);
+
+    _heap.push_back({actorId, distance});
+}
+
+const ActorDistanceQueue::Entry &ActorDistanceQueue::at(size_t index) {
+    assert(index < size());
+
+    if (!_heapReady) {
+        std::ranges::make_heap(_heap, isFarther);
+        _heapReady = true;
+    }
+
+    while (_sorted.size() <= index) {
+        std::ranges::pop_heap(_heap, isFarther);
+        _sorted.push_back(_heap.back());
+        _heap.pop_back();
+    }
+
+    return _sorted[index];
+}
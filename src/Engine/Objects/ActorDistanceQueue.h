@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Lazily sorted list of `(actorId, distance)` pairs, used when building the active AI list.
+ *
+ * Entries are ordered by distance, ties are broken by actor id. Since actors are always pushed in id order, this is
+ * the same order that `std::stable_sort` by distance produces. The difference is that sorting is done on demand with a
+ * binary heap, so the callers that only look at the nearest few actors don't pay for sorting the whole list.
+ */
+class ActorDistanceQueue {
+ public:
+    struct Entry {
+        int actorId = 0;
+        int distance = 0;
+    };
+
+    void clear();
+
+    /**
+     * @param actorId                   Actor id, must be larger than the ids of all the actors pushed before.
+     * @param distance                  Distance to the party.
+     */
+    void push(int actorId, int distance);
+
+    [[nodiscard]] size_t size() const {
+        return _sorted.size() + _heap.size();
+    }
+
+    /**
+     * @param index                     Index in sorted order, must be less than `size()`.
+     * @return                          Entry at the given index. Sorts the list up to `index` if needed.
+     */
+    [[nodiscard]] const Entry &at(size_t index);
+
+    /**
+     * @return                          Number of entries that are already sorted, accessing these with `at` is free.
+     */
+    [[nodiscard]] size_t sortedSize() const {
+        return _sorted.size();
+    }
+
+    /**
+     * Calls the provided callback for all entries that haven't been sorted yet, in no particular order.
+     */
+    template<class Callback>
+    void forEachUnsorted(Callback &&callback) const {
+        for (const Entry &entry : _heap)
+            callback(entry);
+    }
+
+ private:
+    std::vector<Entry> _sorted;
+    std::vector<Entry> _heap;
+    bool _heapReady = false;
+};
@@ -57,6 +57,7 @@
 #include "Library/Logger/Logger.h"
 
 #include "Utility/Memory/MemSet.h"
+#include "Utility/ScopeGuard.h"
 #include "Utility/IndexedArray.h"
 
 static SpellFxRenderer *spell_fx_renderer = EngineIocContainer::ResolveSpellFxRenderer();
@@ -369,6 +370,7 @@ void Character::ItemsPotionDmgBreak(int count) {
         for (InventoryEntry entry : entries) // break everything on eradication, item hardening doesn't help in this case.
             entry->flags |= ITEM_BROKEN;
     }
+    invalidateStatCache();
 }
 
 //----- (00492C0B) --------------------------------------------------------
@@ -710,6 +712,10 @@ int Character::GetBaseLevel() const {
 
 //----- (0048C90D) --------------------------------------------------------
 int Character::GetActualLevel() const {
+    return _statCache.get(&_statCache.actualLevel, [this] { return calculateActualLevel(); });
+}
+
+int Character::calculateActualLevel() const {
     return uLevel + sLevelModifier +
            GetMagicalBonus(ATTRIBUTE_LEVEL) +
            GetItemsBonus(ATTRIBUTE_LEVEL);
@@ -752,6 +758,10 @@ int Character::GetActualLuck() const {
 
 //----- (new function) --------------------------------------------------------
 int Character::GetActualStat(Attribute stat) const {
+    return _statCache.get(&_statCache.actualStats[stat], [this, stat] { return calculateActualStat(stat); });
+}
+
+int Character::calculateActualStat(Attribute stat) const {
     int attrValue = _stats[stat];
     int attrBonus = _statBonuses[stat];
 
@@ -791,6 +801,11 @@ int Character::GetActualStat(Attribute stat) const {
 
 //----- (0048CCF5) --------------------------------------------------------
 int Character::GetActualAttack(bool onlyMainHandDmg) const {
+    std::optional<int> *slot = onlyMainHandDmg ? &_statCache.actualMainHandAttack : &_statCache.actualAttack;
+    return _statCache.get(slot, [this, onlyMainHandDmg] { return calculateActualAttack(onlyMainHandDmg); });
+}
+
+int Character::calculateActualAttack(bool onlyMainHandDmg) const {
     int parbonus = GetParameterBonus(
         GetActualAccuracy());  // bonus points for steps of accuracy level
     int atkskillbonus = GetSkillBonus(
@@ -805,6 +820,10 @@ int Character::GetActualAttack(bool onlyMainHandDmg) const {
 
 //----- (0048CD45) --------------------------------------------------------
 int Character::GetMeleeDamageMinimal() const {
+    return _statCache.get(&_statCache.meleeDamageMin, [this] { return calculateMeleeDamageMinimal(); });
+}
+
+int Character::calculateMeleeDamageMinimal() const {
     int parbonus = GetParameterBonus(GetActualMight());
     int weapbonus = GetItemsBonus(ATTRIBUTE_MELEE_DMG_MIN) + parbonus;
     int atkskillbonus =
@@ -821,6 +840,10 @@ int Character::GetMeleeDamageMinimal() const {
 
 //----- (0048CD90) --------------------------------------------------------
 int Character::GetMeleeDamageMaximal() const {
+    return _statCache.get(&_statCache.meleeDamageMax, [this] { return calculateMeleeDamageMaximal(); });
+}
+
+int Character::calculateMeleeDamageMaximal() const {
     int parbonus = GetParameterBonus(GetActualMight());
     int weapbonus = GetItemsBonus(ATTRIBUTE_MELEE_DMG_MAX) + parbonus;
     int atkskillbonus =
@@ -1348,6 +1371,7 @@ int Character::receiveDamage(signed int amount, DamageType dmg_type) {
                 if (!(equippedArmor->flags &
                       ITEM_HARDENED)) {          // if its not hardened
                     equippedArmor->SetBroken();  // break it
+                    invalidateStatCache();
                 }
             }
         }
@@ -1606,6 +1630,7 @@ int Character::ReceiveSpecialAttackEffect(MonsterSpecialAttack attType, Actor *p
                 if (!(itemtobreak->flags & ITEM_HARDENED)) {
                     playReaction(SPEECH_ITEM_BROKEN);
                     itemtobreak->SetBroken();
+                    invalidateStatCache();
                     pAudioPlayer->playUISound(SOUND_metal_vs_metal03h);
                 }
                 spell_fx_renderer->SetPlayerBuffAnim(SPELL_DISEASE, whichplayer);
@@ -1633,6 +1658,7 @@ int Character::ReceiveSpecialAttackEffect(MonsterSpecialAttack attType, Actor *p
             case SPECIAL_ATTACK_AGING:
                 playReaction(SPEECH_AGING);
                 ++this->sAgeModifier;
+                invalidateStatCache();
                 pAudioPlayer->playUISound(SOUND_eleccircle);
                 spell_fx_renderer->SetPlayerBuffAnim(SPELL_DISEASE, whichplayer);
                 return 1;
@@ -1801,6 +1827,10 @@ float Character::GetArmorRecoveryMultiplierFromSkillLevel(Skill armour_skill_typ
 
 //----- (0048E4F8) --------------------------------------------------------
 int Character::GetMaxHealth() const {
+    return _statCache.get(&_statCache.maxHealth, [this] { return calculateMaxHealth(); });
+}
+
+int Character::calculateMaxHealth() const {
     int endbonus = GetParameterBonus(GetActualEndurance());
     int healthbylevel =
         pBaseHealthPerLevelByClass[classType] * (GetActualLevel() + endbonus);
@@ -1816,6 +1846,10 @@ int Character::GetMaxHealth() const {
 
 //----- (0048E565) --------------------------------------------------------
 int Character::GetMaxMana() const {
+    return _statCache.get(&_statCache.maxMana, [this] { return calculateMaxMana(); });
+}
+
+int Character::calculateMaxMana() const {
     int mainmanastat;
     int statbonus;
     int addmanastat;
@@ -1886,6 +1920,10 @@ int Character::GetMaxMana() const {
 
 //----- (0048E656) --------------------------------------------------------
 int Character::GetBaseAC() const {
+    return _statCache.get(&_statCache.baseAC, [this] { return calculateBaseAC(); });
+}
+
+int Character::calculateBaseAC() const {
     int spd = GetActualSpeed();
     int spdbonus = GetParameterBonus(spd);
     int itembonus = GetItemsBonus(ATTRIBUTE_AC_BONUS) + spdbonus;
@@ -1899,6 +1937,10 @@ int Character::GetBaseAC() const {
 
 //----- (0048E68F) --------------------------------------------------------
 int Character::GetActualAC() const {
+    return _statCache.get(&_statCache.actualAC, [this] { return calculateActualAC(); });
+}
+
+int Character::calculateActualAC() const {
     int spd = GetActualSpeed();
     int spdbonus = GetParameterBonus(spd);
     int itembonus = GetItemsBonus(ATTRIBUTE_AC_BONUS) + spdbonus;
@@ -2093,6 +2135,12 @@ int Character::GetSpecialItemBonus(ItemEnchantment enchantment) const {
 
 //----- (0048EAAE) --------------------------------------------------------
 int Character::GetItemsBonus(Attribute attr, bool getOnlyMainHandDmg /*= false*/) const {
+    if (getOnlyMainHandDmg || !_statCache.itemsBonus.indices().contains(attr))
+        return calculateItemsBonus(attr, getOnlyMainHandDmg);
+    return _statCache.get(&_statCache.itemsBonus[attr], [this, attr] { return calculateItemsBonus(attr, false); });
+}
+
+int Character::calculateItemsBonus(Attribute attr, bool getOnlyMainHandDmg) const {
     int v5;                     // edi@1
     int v14;                    // ecx@58
     int v15;                    // eax@58
@@ -2872,6 +2920,7 @@ void Character::SetInitialStats() {
     Race race = GetRace();
     for (Attribute stat : allStatAttributes())
         _stats[stat] = StatTable[race][stat].uBaseValue;
+    invalidateStatCache();
 }
 
 //----- (004901FC) --------------------------------------------------------
@@ -2926,6 +2975,7 @@ void Character::ChangeClass(Class cls) {
         }
     }
 
+    invalidateStatCache();
     health = GetMaxHealth();
     mana = GetMaxMana();
 }
@@ -2967,6 +3017,7 @@ Skill Character::GetSkillIdxByOrder(signed int order) {
 //----- (0049048D) --------------------------------------------------------
 // uint16_t PartyCreation_BtnMinusClick(Character *_this, int eAttribute)
 void Character::DecreaseAttribute(Attribute eAttribute) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     int pBaseValue;    // ecx@1
     int pDroppedStep;  // ebx@1
     int pStep;         // esi@1
@@ -2985,6 +3036,7 @@ void Character::DecreaseAttribute(Attribute eAttribute) {
 //----- (004905F5) --------------------------------------------------------
 // signed int  PartyCreation_BtnPlusClick(Character *this, int eAttribute)
 void Character::IncreaseAttribute(Attribute eAttribute) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     int maxValue;            // ebx@1
     signed int baseStep;     // edi@1
     signed int tmp;          // eax@17
@@ -3036,6 +3088,8 @@ void Character::resetTempBonuses() {
     this->uFullManaBonus = 0;
     this->_health_related = 0;
     this->uFullHealthBonus = 0;
+
+    invalidateStatCache();
 }
 
 //----- (004907E7) --------------------------------------------------------
@@ -3063,6 +3117,7 @@ bool Character::DiscardConditionIfLastsLongerThan(Condition uCondition,
 }
 
 void Character::useItem(int targetCharacter, bool isPortraitClick) {
+    MM_AT_SCOPE_EXIT(CharacterStatCache::invalidateAll()); // Might affect a different character.
     Character *playerAffected = &pParty->pCharacters[targetCharacter];
     if (pParty->bTurnBasedModeOn && (pTurnEngine->turn_stage == TE_WAIT || pTurnEngine->turn_stage == TE_MOVEMENT)) {
         return;
@@ -3989,6 +4044,7 @@ bool Character::CompareVariable(EvtVariable VarNum, int pValue) {
 
 //----- (0044A5CB) --------------------------------------------------------
 void Character::SetVariable(EvtVariable var_type, signed int var_value) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     int gold{}, food{};
     LocationInfo *ddm;
     Item item;
@@ -4600,6 +4656,7 @@ void Character::SetSkillReaction() {
 
 //----- (0044AFFB) --------------------------------------------------------
 void Character::AddVariable(EvtVariable var_type, signed int val) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     int food{};
     LocationInfo *ddm;
     Item item;
@@ -5168,6 +5225,7 @@ void Character::PlayAwardSound_Anim97_Face(SpeechId speech) {
 
 //----- (new function) --------------------------------------------------------
 void Character::AddSkillByEvent(Skill skill, uint16_t addSkillValue) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     auto [addLevel, addMastery] = CombinedSkillValue::fromJoinedUnchecked(addSkillValue);
 
     int newLevel = pActiveSkills[skill].level() + addLevel;
@@ -5178,6 +5236,7 @@ void Character::AddSkillByEvent(Skill skill, uint16_t addSkillValue) {
 
 //----- (0044B9C4) --------------------------------------------------------
 void Character::SubtractVariable(EvtVariable VarNum, signed int pValue) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     LocationInfo *locationHeader;  // eax@90
     int randGold;
     int randFood;
@@ -5719,6 +5778,7 @@ void Character::PlayAwardSound_AnimSubtract_Face(SpeechId speech) {
 
 //----- (new function) --------------------------------------------------------
 void Character::SubtractSkillByEvent(Skill skill, uint16_t subSkillValue) {
+    MM_AT_SCOPE_EXIT(invalidateStatCache());
     auto [subLevel, subMastery] = CombinedSkillValue::fromJoinedUnchecked(subSkillValue);
 
     if (pActiveSkills[skill] == CombinedSkillValue::none())
@@ -6587,6 +6647,7 @@ CombinedSkillValue Character::getSkillValue(Skill skill) const {
 
 void Character::setSkillValue(Skill skill, const CombinedSkillValue &value) {
     pActiveSkills[skill] = value;
+    invalidateStatCache();
 }
 
 void Character::setXP(int xp) {
@@ -6796,6 +6857,7 @@ Character::Character() {
 }
 
 void Character::Zero() {
+    invalidateStatCache();
     name = std::string();
     uSex = SEX_MALE;
     classType = CLASS_KNIGHT;
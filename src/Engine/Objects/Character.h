@@ -29,6 +29,7 @@
 
 #include "TalkAnimation.h"
 #include "CharacterConditions.h"
+#include "CharacterStatCache.h"
 
 class Actor;
 class GraphicsImage;
@@ -310,6 +311,16 @@ class Character {
 
     void tickRegeneration(int tick5, const RegenData &rData, bool stacking);
 
+    /**
+     * Drops cached derived stats of this character. Must be called after directly changing the fields that affect
+     * `GetActualStat`, `GetActualAC`, `GetMaxHealth` and friends if these are then read in the same frame.
+     *
+     * @see CharacterStatCache
+     */
+    void invalidateStatCache() {
+        _statCache.invalidate();
+    }
+
     CharacterConditions conditions;
     uint64_t experience;
     std::string name;
@@ -378,6 +389,21 @@ class Character {
     char uNumDivineInterventionCastsThisDay;
     char uNumArmageddonCasts;
     char uNumFireSpikeCasts;
+
+ private:
+    int calculateActualStat(Attribute stat) const;
+    int calculateActualLevel() const;
+    int calculateActualAttack(bool onlyMainHandDmg) const;
+    int calculateMeleeDamageMinimal() const;
+    int calculateMeleeDamageMaximal() const;
+    int calculateBaseAC() const;
+    int calculateActualAC() const;
+    int calculateMaxHealth() const;
+    int calculateMaxMana() const;
+    int calculateItemsBonus(Attribute attr, bool getOnlyMainHandDmg) const;
+
+ private:
+    mutable CharacterStatCache _statCache;
 };
 
 void DamageCharacterFromMonster(Pid uObjID, ActorAbility dmgSource, signed int a4);
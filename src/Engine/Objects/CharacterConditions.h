@@ -7,6 +7,7 @@
 #include "Utility/IndexedArray.h"
 
 #include "CharacterEnums.h"
+#include "CharacterStatCache.h"
 
 struct CharacterConditions_MM7;
 
@@ -29,15 +30,18 @@ class CharacterConditions {
 
     void reset(Condition condition) {
         _times[condition] = Time();
+        CharacterStatCache::invalidateAll();
     }
 
     void resetAll() {
         for (Time &time : _times)
             time = Time();
+        CharacterStatCache::invalidateAll();
     }
 
     void set(Condition condition, Time time) {
         _times[condition] = time;
+        CharacterStatCache::invalidateAll();
     }
 
     [[nodiscard]] Time get(Condition condition) const {
@@ -0,0 +1,42 @@
+#include "CharacterStatCache.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Party.h"
+
+#include "Library/Logger/Logger.h"
+
+uint64_t CharacterStatCache::_globalGeneration = 1;
+bool CharacterStatCache::_verify = false;
+
+void CharacterStatCache::invalidateAll() {
+    _globalGeneration++;
+    _verify = engine && engine->config->debug.VerifyStatCache.value();
+}
+
+void CharacterStatCache::invalidate() {
+    itemsBonus.fill(std::nullopt);
+    actualStats.fill(std::nullopt);
+    actualLevel.reset();
+    actualAttack.reset();
+    actualMainHandAttack.reset();
+    meleeDamageMin.reset();
+    meleeDamageMax.reset();
+    baseAC.reset();
+    actualAC.reset();
+    maxHealth.reset();
+    maxMana.reset();
+}
+
+void CharacterStatCache::validate() {
+    int year = pParty ? pParty->GetPlayingTime().toYears() : 0;
+    if (_generation == _globalGeneration && _year == year)
+        return;
+
+    invalidate();
+    _generation = _globalGeneration;
+    _year = year;
+}
+
+void CharacterStatCache::reportMismatch(int cached, int actual) {
+    logger->error("Character stat cache is out of date, cached value is {}, actual value is {}", cached, actual);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "Utility/IndexedArray.h"
+
+#include "CharacterEnums.h"
+
+/**
+ * Cache of derived character stats, e.g. actual attributes, attack, AC, max health and max mana. All of these used to
+ * be recalculated from scratch on each call, walking all the equipped items & enchantments, while the UI and combat
+ * code would call them dozens of times per frame.
+ *
+ * Invalidation is explicit. Cached values for a single character are dropped with `invalidate`, and this is what
+ * `Character` methods that change equipment, skills or base stats do. Changes that can't be attributed to a single
+ * character, like conditions, buffs, hirelings or direct `Inventory` manipulation, go through `invalidateAll`, which
+ * bumps a global generation counter. The game loop also calls `invalidateAll` once per frame & once per processed
+ * message, so that direct writes into `Character` fields are picked up too. Character age depends on game time, so
+ * the cache is additionally keyed by the current year.
+ *
+ * Set `debug.verify_stat_cache` to cross-check cached values against fresh calculation. Mismatches are logged as
+ * errors, and fresh values are returned.
+ */
+class CharacterStatCache {
+ public:
+    /**
+     * Invalidates stat caches for all characters.
+     */
+    static void invalidateAll();
+
+    /**
+     * Invalidates cached stats of the character that owns this cache.
+     */
+    void invalidate();
+
+    /**
+     * @param slot                      Cache slot, one of the members of this class.
+     * @param calculate                 Functor that calculates the value.
+     * @return                          Cached value, or the result of `calculate` if there was no cached value.
+     */
+    template<class Callable>
+    int get(std::optional<int> *slot, Callable &&calculate) {
+        validate();
+
+        if (*slot && !_verify)
+            return **slot;
+
+        int result = calculate();
+        if (*slot && **slot != result)
+            reportMismatch(**slot, result);
+        *slot = result;
+        return result;
+    }
+
+    IndexedArray<std::optional<int>, ATTRIBUTE_MIGHT, ATTRIBUTE_SKILL_LEARNING> itemsBonus;
+    IndexedArray<std::optional<int>, ATTRIBUTE_FIRST_STAT, ATTRIBUTE_LAST_STAT> actualStats;
+    std::optional<int> actualLevel;
+    std::optional<int> actualAttack;
+    std::optional<int> actualMainHandAttack;
+    std::optional<int> meleeDamageMin;
+    std::optional<int> meleeDamageMax;
+    std::optional<int> baseAC;
+    std::optional<int> actualAC;
+    std::optional<int> maxHealth;
+    std::optional<int> maxMana;
+
+ private:
+    void validate();
+    static void reportMismatch(int cached, int actual);
+
+ private:
+    static uint64_t _globalGeneration;
+    static bool _verify;
+
+    uint64_t _generation = 0;
+    int _year = 0;
+};
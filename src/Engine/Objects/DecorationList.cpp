@@ -4,7 +4,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Sprites.h"
 
-#include "Utility/String/Ascii.h"
+#include "Utility/MapAccess.h"
 
 
 DecorationList *pDecorationList;
@@ -14,17 +14,19 @@ void DecorationList::InitializeDecorationSprite(DecorationId uDecID) {
 }
 
 DecorationId DecorationList::GetDecorIdByName(std::string_view pName) {
-    if (pName.empty())
-        return DECORATION_NULL;
+    return GetDecorIdByName(NameAtom(pName));
+}
 
-    if (pDecorations.size() > 1) {
-        for (unsigned uID = 1; uID < pDecorations.size(); ++uID) {
-            if (ascii::noCaseEquals(pName, pDecorations[uID].name))
-                return static_cast<DecorationId>(uID);
-        }
-    }
+DecorationId DecorationList::GetDecorIdByName(NameAtom name) {
+    return valueOr(_decorationIdByName, name, DECORATION_NULL);
+}
 
-    return DECORATION_NULL;
+void DecorationList::rebuildNameIndex() {
+    // Decoration 0 is a dummy one and is never found by name, and for duplicate names the first one wins.
+    _decorationIdByName.clear();
+    for (unsigned uID = 1; uID < pDecorations.size(); ++uID)
+        if (!pDecorations[uID].name.empty())
+            _decorationIdByName.emplace(NameAtom(pDecorations[uID].name), static_cast<DecorationId>(uID));
 }
 
 void RespawnGlobalDecorations() {
@@ -3,11 +3,15 @@
 #include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "Media/Audio/SoundEnums.h"
 
 #include "Library/Color/Color.h"
 
+#include "Utility/String/NameAtom.h"
+
 #include "DecorationEnums.h"
 
 struct DecorationDesc {
@@ -41,13 +45,22 @@ class DecorationList {
 
     void InitializeDecorationSprite(DecorationId uDecID);
     DecorationId GetDecorIdByName(std::string_view pName);
+    DecorationId GetDecorIdByName(NameAtom name);
 
     const DecorationDesc *GetDecoration(DecorationId index) const {
         return &pDecorations[std::to_underlying(index)];
     }
 
+    /**
+     * Rebuilds the name index used by `GetDecorIdByName`. Must be called after `pDecorations` was changed.
+     */
+    void rebuildNameIndex();
+
  public:
     std::vector<DecorationDesc> pDecorations; // TODO(captainurist): IndexedArray.
+
+ private:
+    std::unordered_map<NameAtom, DecorationId> _decorationIdByName;
 };
 
 extern DecorationList *pDecorationList;
@@ -1,15 +1,28 @@
 #include "Inventory.h"
 
 #include <cassert>
+#include <bit>
 
 #include "Engine/Snapshots/EntitySnapshots.h"
 #include "Library/Snapshots/CommonSnapshots.h"
 #include "Engine/Tables/ChestTable.h"
 #include "Library/Logger/Logger.h"
 
+#include "CharacterStatCache.h"
+
+/**
+ * @param count                         Number of bits to set, in `[0, 64]`.
+ * @return                              Bitmask with `count` lowest bits set.
+ */
+static uint64_t lowBits(int count) {
+    assert(count >= 0 && count <= 64);
+    return count == 64 ? ~0ull : (1ull << count) - 1;
+}
+
 Inventory::Inventory(Sizei gridSize, int capacity) : _gridSize(gridSize), _capacity(capacity) {
     assert(gridSize.w > 0 && gridSize.h > 0);
     assert(gridSize.w * gridSize.h <= MAX_ITEMS);
+    assert(gridSize.w <= MAX_GRID_WIDTH);
     assert(capacity > 0);
     assert(capacity <= MAX_ITEMS);
 }
@@ -142,12 +155,15 @@ Item Inventory::take(InventoryEntry entry) {
         for (int y = 0; y < geometry.h; y++, xy += _gridSize.w - geometry.w)
             for (int x = 0; x < geometry.w; x++, xy++)
                 _grid[xy] = 0;
+        setGridOccupied(geometry, false);
     } else if (entry.zone() == INVENTORY_ZONE_EQUIPMENT) {
         _equipment[entry.slot()] = 0;
+        CharacterStatCache::invalidateAll();
     }
 
     Item result = *entry;
     _records[entry.index()] = {};
+    setRecordUsed(entry.index(), false);
     _size--;
 
     checkInvariants();
@@ -163,18 +179,42 @@ std::optional<Pointi> Inventory::findSpace(Sizei size) const {
     if (_gridSize.w < size.w || _gridSize.h < size.h)
         return std::nullopt;
 
-    for (int x = 0, xx = _gridSize.w - size.w + 1; x < xx; x++)
-        for (int y = 0, yy = _gridSize.h - size.h + 1; y < yy; y++)
-            if (isGridFree(Pointi(x, y), size))
-                return Pointi(x, y);
+    // Bit x in fits[y] is set if an item of the given width fits into row y at column x.
+    uint64_t originMask = lowBits(_gridSize.w - size.w + 1);
+    std::array<uint64_t, MAX_ITEMS> fits;
+    for (int y = 0; y < _gridSize.h; y++) {
+        uint64_t free = ~_gridRows[y];
+        uint64_t fit = free;
+        for (int x = 1; x < size.w; x++)
+            fit &= free >> x;
+        fits[y] = fit & originMask;
+    }
+
+    // The original search order is column by column, so we're looking for the leftmost fit, topmost on ties.
+    std::optional<Pointi> result;
+    for (int y = 0, yy = _gridSize.h - size.h + 1; y < yy; y++) {
+        uint64_t fit = fits[y];
+        for (int dy = 1; dy < size.h && fit; dy++)
+            fit &= fits[y + dy];
+        if (!fit)
+            continue;
 
-    return std::nullopt;
+        int x = std::countr_zero(fit);
+        if (!result || x < result->x)
+            result = Pointi(x, y);
+    }
+
+    return result;
 }
 
 InventoryEntry Inventory::find(ItemId itemId) {
-    for (int i = 0; i < _capacity; i++)
-        if (_records[i].item.itemId == itemId)
-            return InventoryEntry(this, i);
+    for (int i = 0; i < _usedRecords.size(); i++) {
+        for (uint64_t used = _usedRecords[i]; used; used &= used - 1) {
+            int index = i * 64 + std::countr_zero(used);
+            if (_records[index].item.itemId == itemId)
+                return InventoryEntry(this, index);
+        }
+    }
     return {};
 }
 
@@ -183,23 +223,49 @@ void Inventory::clear() {
     _records.fill(InventoryRecord());
     _grid.fill(0);
     _equipment.fill(0);
+    _gridRows.fill(0);
+    _usedRecords.fill(0);
+    CharacterStatCache::invalidateAll();
     checkInvariants();
 }
 
 int Inventory::findFreeIndex() const {
-    auto pos = std::ranges::find_if(availableRecords(), [](const InventoryRecord &data) { return data.item.itemId == ITEM_NULL; });
-    return pos == availableRecords().end() ? -1 : pos - availableRecords().begin();
+    for (int i = 0; i < _usedRecords.size(); i++) {
+        int bit = std::countr_one(_usedRecords[i]);
+        if (bit < 64) {
+            int index = i * 64 + bit;
+            return index < _capacity ? index : -1;
+        }
+    }
+    return -1;
 }
 
 bool Inventory::isGridFree(Pointi position, Sizei size) const {
     assert(gridRect().contains(Recti(position, size)));
-    for (int y = 0, xy = position.y * _gridSize.w + position.x; y < size.h; y++, xy += _gridSize.w - size.w)
-        for (int x = 0; x < size.w; x++, xy++)
-            if (_grid[xy] != 0)
-                return false;
+    uint64_t mask = lowBits(size.w) << position.x;
+    for (int y = position.y; y < position.y + size.h; y++)
+        if (_gridRows[y] & mask)
+            return false;
     return true;
 }
 
+void Inventory::setGridOccupied(Recti rect, bool occupied) {
+    uint64_t mask = lowBits(rect.w) << rect.x;
+    for (int y = rect.y; y < rect.y + rect.h; y++) {
+        assert(((_gridRows[y] & mask) == mask) != occupied);
+        _gridRows[y] ^= mask;
+    }
+}
+
+void Inventory::setRecordUsed(int index, bool used) {
+    uint64_t bit = 1ull << (index % 64);
+    if (used) {
+        _usedRecords[index / 64] |= bit;
+    } else {
+        _usedRecords[index / 64] &= ~bit;
+    }
+}
+
 InventoryEntry Inventory::addAt(Pointi position, const Item &item, int index) {
     int cornerXy = position.y * _gridSize.w + position.x;
     Sizei itemSize = item.inventorySize();
@@ -207,12 +273,14 @@ InventoryEntry Inventory::addAt(Pointi position, const Item &item, int index) {
         for (int x = 0; x < itemSize.w; x++, xy++)
             _grid[xy] = -cornerXy - 1;
     _grid[cornerXy] = index + 1;
+    setGridOccupied(Recti(position, itemSize), true);
 
     InventoryRecord &record = _records[index];
     record.item = item;
     record.zone = INVENTORY_ZONE_GRID;
     record.position = position;
     record.slot = ITEM_SLOT_INVALID;
+    setRecordUsed(index, true);
     _size++;
 
     checkInvariants();
@@ -227,7 +295,9 @@ InventoryEntry Inventory::equipAt(ItemSlot slot, const Item &item, int index) {
     record.zone = INVENTORY_ZONE_EQUIPMENT;
     record.position = Pointi();
     record.slot = slot;
+    setRecordUsed(index, true);
     _size++;
+    CharacterStatCache::invalidateAll();
 
     checkInvariants();
     return InventoryEntry(this, index);
@@ -239,6 +309,7 @@ InventoryEntry Inventory::stashAt(const Item &item, int index) {
     record.zone = INVENTORY_ZONE_STASH;
     record.position = Pointi();
     record.slot = ITEM_SLOT_INVALID;
+    setRecordUsed(index, true);
     _size++;
 
     checkInvariants();
@@ -276,6 +347,13 @@ void Inventory::checkInvariants() const {
         }
     }
 
+    // Check that occupancy bitmasks are in sync.
+    for (int y = 0; y < _gridSize.h; y++)
+        for (int x = 0; x < _gridSize.w; x++)
+            assert(((_gridRows[y] >> x) & 1) == (_grid[y * _gridSize.w + x] != 0));
+    for (int i = 0; i < MAX_ITEMS; i++)
+        assert(((_usedRecords[i / 64] >> (i % 64)) & 1) == (_records[i].item.itemId != ITEM_NULL));
+
     // Check that equipment looks valid.
     for (ItemSlot i : _equipment.indices()) {
         if (_equipment[i] == 0)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdint>
 #include <array>
 #include <ranges>
 #include <optional>
@@ -127,9 +128,11 @@ class InventoryEntry : public InventoryConstEntry {
 class Inventory {
  public:
     static constexpr std::size_t MAX_ITEMS = 140;
+    static constexpr int MAX_GRID_WIDTH = 64;
 
     /**
-     * @param gridSize                  Size of inventory's grid, WxH must be less or equal to `MAX_ITEMS`.
+     * @param gridSize                  Size of inventory's grid, WxH must be less or equal to `MAX_ITEMS`, and W
+     *                                  must be less or equal to `MAX_GRID_WIDTH`.
      * @param capacity                  Inventory capacity, must be less or equal to `MAX_ITEMS`.
      */
     explicit Inventory(Sizei gridSize, int capacity);
@@ -310,6 +313,8 @@ class Inventory {
 
     [[nodiscard]] int findFreeIndex() const;
     [[nodiscard]] bool isGridFree(Pointi position, Sizei size) const;
+    void setGridOccupied(Recti rect, bool occupied);
+    void setRecordUsed(int index, bool used);
     InventoryEntry addAt(Pointi position, const Item &item, int index);
     InventoryEntry equipAt(ItemSlot slot, const Item &item, int index);
     InventoryEntry stashAt(const Item &item, int index);
@@ -346,6 +351,13 @@ class Inventory {
 
     /** Equipment array. Positive number is an index into `_records` plus one. Zero means empty. */
     IndexedArray<int, ITEM_SLOT_FIRST_VALID, ITEM_SLOT_LAST_VALID> _equipment = {{}};
+
+    /** Grid occupancy, one bitmask per row. Bit `x` in `_gridRows[y]` is set if cell `(x, y)` is taken. This is
+     * what `findSpace` works with, so that it doesn't need to rescan `_grid` for each candidate position. */
+    std::array<uint64_t, MAX_ITEMS> _gridRows = {{}};
+
+    /** Bitmask of used records, bit `i` is set if `_records[i]` holds an item. */
+    std::array<uint64_t, (MAX_ITEMS + 63) / 64> _usedRecords = {{}};
 };
 
 
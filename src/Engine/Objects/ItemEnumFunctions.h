@@ -271,6 +271,10 @@ inline Segment<ItemSlot> itemSlotsForItemType(ItemType type) {
 // RandomItemType
 //
 
+inline bool isSpawnableRandomItemType(RandomItemType type) {
+    return type >= RANDOM_ITEM_FIRST_SPAWNABLE && type <= RANDOM_ITEM_LAST_SPAWNABLE;
+}
+
 inline Segment<RandomItemType> allSpawnableRandomItemTypes() {
     return {RANDOM_ITEM_FIRST_SPAWNABLE, RANDOM_ITEM_LAST_SPAWNABLE};
 }
@@ -13,6 +13,7 @@
 #include "Utility/String/Ascii.h"
 #include "Utility/Exception.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 MonsterStats *pMonsterStats;
 MonsterList *pMonsterList;
@@ -315,9 +316,9 @@ void MonsterStats::InitializePlacements(const Blob &placements) {
     //  int item_counter;
 
     std::string txtRaw(placements.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     for (i = 1; i < 31; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -359,13 +360,13 @@ void MonsterStats::Initialize(const Blob &monsters) {
     std::string str;
 
     std::string txtRaw(monsters.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
+    threadSafeStrtok(NULL, "\r");
+    threadSafeStrtok(NULL, "\r");
     curr_rec_num = MONSTER_INVALID;
     for (i = 0; i < 264; ++i) { // TODO(captainurist): get rid of magic numbers in txt deserialization.
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
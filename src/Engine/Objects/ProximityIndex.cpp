@@ -0,0 +1,86 @@
+#include "ProximityIndex.h"
+
+#include <algorithm>
+
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/SpriteObject.h"
+
+ProximityIndex proximityIndex;
+
+static constexpr float CELL_SIZE = 512;
+
+ProximityIndex::ProximityIndex() : _actors{SpatialHash(CELL_SIZE)}, _spriteObjects{SpatialHash(CELL_SIZE)} {}
+
+void ProximityIndex::syncActors() {
+    _actors.hash.resize(pActors.size());
+    _actors.invalidated.clear();
+
+    float maxRadius = 0;
+    for (size_t i = 0; i < pActors.size(); i++) {
+        const Actor &actor = pActors[i];
+        _actors.hash.update(i, actor.pos);
+
+        // Some of the collision code overrides actor radius with the to-hit radius, need to account for that.
+        maxRadius = std::max<float>(maxRadius, actor.radius);
+        if (actor.word_000086_some_monster_id != MONSTER_INVALID)
+            maxRadius = std::max<float>(maxRadius, pMonsterList->monsters[actor.word_000086_some_monster_id].toHitRadius);
+    }
+    _actors.maxRadius = maxRadius;
+}
+
+void ProximityIndex::syncSpriteObjects() {
+    _spriteObjects.hash.resize(pSpriteObjects.size());
+    _spriteObjects.invalidated.clear();
+
+    float maxRadius = 0;
+    for (size_t i = 0; i < pSpriteObjects.size(); i++) {
+        const SpriteObject &object = pSpriteObjects[i];
+        _spriteObjects.hash.update(i, object.vPosition);
+        if (object.uObjectDescID)
+            maxRadius = std::max<float>(maxRadius, pObjectList->pObjects[object.uObjectDescID].uRadius);
+    }
+    _spriteObjects.maxRadius = maxRadius;
+}
+
+void ProximityIndex::invalidateActor(int id) {
+    _actors.invalidated.push_back(id);
+}
+
+void ProximityIndex::invalidateSpriteObject(int id) {
+    _spriteObjects.invalidated.push_back(id);
+}
+
+void ProximityIndex::actorsIn(const BBoxf &bbox, std::vector<int> *result) {
+    _actors.query(bbox, pActors.size(), result);
+}
+
+void ProximityIndex::spriteObjectsIn(const BBoxf &bbox, std::vector<int> *result) {
+    _spriteObjects.query(bbox, pSpriteObjects.size(), result);
+}
+
+void ProximityIndex::Index::query(const BBoxf &bbox, size_t size, std::vector<int> *result) {
+    // Object lists shouldn't shrink mid-phase, but if they do, we can just drop the tail.
+    if (hash.size() > size)
+        hash.resize(size);
+
+    BBoxf expanded = bbox;
+    expanded.x1 -= maxRadius;
+    expanded.x2 += maxRadius;
+    expanded.y1 -= maxRadius;
+    expanded.y2 += maxRadius;
+    hash.query(expanded, result);
+
+    // Objects that were added or moved since the last sync are always returned.
+    if (invalidated.empty() && hash.size() == size)
+        return;
+
+    for (int id : invalidated)
+        if (id < size)
+            result->push_back(id);
+    for (size_t id = hash.size(); id < size; id++)
+        result->push_back(id);
+    std::ranges::sort(*result);
+    result->erase(std::unique(result->begin(), result->end()), result->end());
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/SpatialHash.h"
+
+/**
+ * Spatial index over `pActors` and `pSpriteObjects` that's used to replace full scans over these lists in collision
+ * and trigger code.
+ *
+ * The index is synced incrementally with the object lists by calling `syncActors` / `syncSpriteObjects` at the start
+ * of each phase that queries it. Objects that get spawned or teleported mid-phase should be invalidated with
+ * `invalidateActor` / `invalidateSpriteObject`, invalidated objects are returned from all queries until the next sync.
+ *
+ * Query results are sorted by object id and are a superset of what the query asks for, so callers should keep their
+ * precise checks in place. This way iteration order and results are exactly the same as for a full scan.
+ */
+class ProximityIndex {
+ public:
+    ProximityIndex();
+
+    void syncActors();
+    void syncSpriteObjects();
+
+    void invalidateActor(int id);
+    void invalidateSpriteObject(int id);
+
+    /**
+     * @param bbox                      Query box.
+     * @param[out] result               Ids of all actors whose collision cylinders might intersect `bbox` in the XY
+     *                                  plane, sorted. Cleared by this function.
+     */
+    void actorsIn(const BBoxf &bbox, std::vector<int> *result);
+
+    /**
+     * @param bbox                      Query box.
+     * @param[out] result               Ids of all sprite objects (including the removed ones) whose collision
+     *                                  cylinders might intersect `bbox` in the XY plane, sorted. Cleared by this
+     *                                  function.
+     */
+    void spriteObjectsIn(const BBoxf &bbox, std::vector<int> *result);
+
+ private:
+    struct Index {
+        SpatialHash hash;
+        float maxRadius = 0;
+        std::vector<int> invalidated;
+
+        void query(const BBoxf &bbox, size_t size, std::vector<int> *result);
+    };
+
+    Index _actors;
+    Index _spriteObjects;
+};
+
+extern ProximityIndex proximityIndex;
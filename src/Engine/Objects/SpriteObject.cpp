@@ -21,6 +21,7 @@
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
+#include "Engine/Objects/ProximityIndex.h"
 #include "Engine/Objects/SpriteEnumFunctions.h"
 
 #include "Engine/Tables/ItemTable.h"
@@ -109,6 +110,7 @@ int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
         pSpriteObjects.resize(sprite_slot + 1);
     }
     pSpriteObjects[sprite_slot] = *this;
+    proximityIndex.invalidateSpriteObject(sprite_slot);
     return sprite_slot;
 }
 
@@ -231,18 +233,20 @@ void SpriteObject::updateObjectODM(unsigned int uLayingItemID) {
         if (casterType != OBJECT_Character) {
             CollideWithParty(false);
         }
+        static std::vector<int> nearActors; // Static so that we don't reallocate on every call.
+        proximityIndex.actorsIn(collision_state.bbox, &nearActors);
         if (casterType == OBJECT_Actor) {
             int actorId = pSpriteObjects[uLayingItemID].spell_caster_pid.id();
             // TODO: why pActors.size() - 1? Should just check for .size()
             if ((actorId >= 0) && (actorId < (pActors.size() - 1))) {
-                for (int j = 0; j < pActors.size(); ++j) {
+                for (int j : nearActors) {
                     if (pActors[actorId].GetActorsRelation(&pActors[j]) != HOSTILITY_FRIENDLY) {
                         CollideWithActor(j, 0);
                     }
                 }
             }
         } else {
-            for (int j = 0; j < pActors.size(); ++j) {
+            for (int j : nearActors) {
                 CollideWithActor(j, 0);
             }
         }
@@ -380,7 +384,9 @@ LABEL_25:
                     CollideWithParty(true);
                 }
 
-                for (int actloop = 0; actloop < (signed int)pActors.size(); ++actloop) {
+                static std::vector<int> nearActors; // Static so that we don't reallocate on every call.
+                proximityIndex.actorsIn(collision_state.bbox, &nearActors);
+                for (int actloop : nearActors) {
                     // dont collide against self monster type
                     if (pSpriteObject->spell_caster_pid.type() == OBJECT_Actor) {
                         if (pActors[pSpriteObject->spell_caster_pid.id()].monsterInfo.id == pActors[actloop].monsterInfo.id) {
@@ -1268,6 +1274,8 @@ void applySpellSpriteDamage(unsigned int uLayingItemID, Pid pid) {
 }
 
 void UpdateObjects() {
+    proximityIndex.syncActors();
+
     for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
         if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
             pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
@@ -0,0 +1,73 @@
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/Character.h"
+#include "Engine/Party.h"
+
+GAME_TEST(CharacterStatCache, Equipment) {
+    // Equipping & taking off items should invalidate the cache.
+    Character character;
+    int ac0 = character.GetActualAC();
+    EXPECT_EQ(character.GetActualAC(), ac0);
+
+    Item armor;
+    armor.itemId = ITEM_LEATHER_ARMOR;
+    InventoryEntry entry = character.inventory.equip(ITEM_SLOT_ARMOUR, armor);
+    int ac1 = character.GetActualAC();
+    EXPECT_GT(ac1, ac0);
+
+    // Breaking an item in place needs an explicit invalidation.
+    entry->SetBroken();
+    character.invalidateStatCache();
+    EXPECT_EQ(character.GetActualAC(), ac0);
+
+    character.inventory.take(entry);
+    EXPECT_EQ(character.GetActualAC(), ac0);
+}
+
+GAME_TEST(CharacterStatCache, BuffsAndConditions) {
+    // Buffs & conditions should invalidate the cache.
+    Character character;
+    character._stats[ATTRIBUTE_MIGHT] = 20;
+    character.invalidateStatCache();
+    int ac0 = character.GetActualAC();
+    int might0 = character.GetActualMight();
+
+    character.pCharacterBuffs[CHARACTER_BUFF_STONESKIN].Apply(pParty->GetPlayingTime() + Duration::fromHours(1),
+                                                              MASTERY_NOVICE, 10, 0, 0);
+    EXPECT_EQ(character.GetActualAC(), ac0 + 10);
+
+    character.pCharacterBuffs[CHARACTER_BUFF_STONESKIN].Reset();
+    EXPECT_EQ(character.GetActualAC(), ac0);
+
+    character.conditions.set(CONDITION_WEAK, pParty->GetPlayingTime());
+    EXPECT_LT(character.GetActualMight(), might0);
+
+    character.conditions.reset(CONDITION_WEAK);
+    EXPECT_EQ(character.GetActualMight(), might0);
+}
+
+GAME_TEST(CharacterStatCache, DirectWrites) {
+    // Direct writes into character fields are picked up after an explicit invalidation.
+    Character character;
+    int might0 = character.GetActualMight();
+
+    character._stats[ATTRIBUTE_MIGHT] += 10;
+    character.invalidateStatCache();
+    EXPECT_EQ(character.GetActualMight(), might0 + 10);
+}
+
+GAME_TEST(CharacterStatCache, AgingAttack) {
+    // Aging attack should lower the stats right away, and not on the next frame.
+    game.startNewGame();
+    Character &character = pParty->pCharacters[0];
+    character._stats[ATTRIBUTE_MIGHT] = 40;
+    character._stats[ATTRIBUTE_ENDURANCE] = 0; // Low endurance & luck so that the saving throw always fails.
+    character._stats[ATTRIBUTE_LUCK] = 0;
+    character.sAgeModifier = 99 - character.GetBaseAge(); // Might drops at 100.
+    character.invalidateStatCache();
+    int might0 = character.GetActualMight();
+
+    EXPECT_EQ(character.ReceiveSpecialAttackEffect(SPECIAL_ATTACK_AGING, nullptr), 1);
+    EXPECT_EQ(character.GetActualAge(), 100);
+    EXPECT_LT(character.GetActualMight(), might0);
+}
@@ -148,3 +148,19 @@ GAME_TEST(Inventory, EntryInvalidation) {
     EXPECT_EQ(entry.slot(), ITEM_SLOT_INVALID);
     EXPECT_EQ(entry.zone(), INVENTORY_ZONE_INVALID);
 }
+
+GAME_TEST(Inventory, FindSpaceAfterTake) {
+    // Space freed by taking out an item should be found again, and the search should go by columns.
+    Inventory inventory(Sizei(3, 3), Inventory::MAX_ITEMS);
+    InventoryEntry ring0 = inventory.add(Pointi(0, 0), Item(ITEM_BRASS_RING));
+    inventory.add(Pointi(0, 1), Item(ITEM_BRASS_RING));
+    inventory.add(Pointi(1, 0), Item(ITEM_BRASS_RING));
+
+    EXPECT_EQ(inventory.findSpace(Sizei(1, 1)), Pointi(0, 2));
+    EXPECT_EQ(inventory.findSpace(Sizei(2, 2)), Pointi(1, 1));
+    EXPECT_FALSE(inventory.findSpace(Sizei(3, 2)));
+
+    inventory.take(ring0);
+    EXPECT_EQ(inventory.findSpace(Sizei(1, 1)), Pointi(0, 0));
+    EXPECT_EQ(inventory.find(ITEM_BRASS_RING).geometry(), Recti(0, 1, 1, 1));
+}
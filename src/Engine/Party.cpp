@@ -472,6 +472,7 @@ void Party::createDefaultParty() {
         }
 
         pCharacter.portraitTimePassed = 0_ticks;
+        pCharacter.invalidateStatCache();
         pCharacter.health = pCharacter.GetMaxHealth();
         pCharacter.mana = pCharacter.GetMaxMana();
     }
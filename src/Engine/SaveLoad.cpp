@@ -2,9 +2,12 @@
 
 #include <cassert>
 #include <algorithm>
+#include <future>
+#include <optional>
 #include <string>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineFileSystem.h"
@@ -37,6 +40,9 @@
 #include "Library/Lod/LodWriter.h"
 #include "TurnEngine/TurnEngine.h"
 
+#include "Utility/String/Ascii.h"
+#include "Utility/Exception.h"
+
 SavegameList *pSavegameList = new SavegameList;
 
 static LodInfo makeSaveLodInfo() {
@@ -48,6 +54,8 @@ static LodInfo makeSaveLodInfo() {
 }
 
 void LoadGame(int uSlot) {
+    FinishPendingSave();
+
     if (!pSavegameList->pSavegameUsedSlots[uSlot]) {
         pAudioPlayer->playUISound(SOUND_error);
         logger->warning("LoadGame: slot {} is empty", uSlot);
@@ -149,11 +157,37 @@ void LoadGame(int uSlot) {
     bFlashHistoryBook = false;
 }
 
-std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title) {
-    std::pair<SaveGameHeader, Blob> result;
-    auto &[resultHeader, resultBlob] = result;
-    BlobOutputStream lodStream(&resultBlob);
-    LodWriter lodWriter(&lodStream, makeSaveLodInfo());
+namespace {
+
+/**
+ * Everything that goes into a save file, captured on the game thread. Building the actual save file out of this is
+ * thread-safe.
+ */
+struct SaveSnapshot {
+    SaveGame_MM7 save;
+    std::vector<std::pair<std::string, Blob>> files; // Files that go into the save as is, shared with the source LOD.
+    std::string deltaName; // Name of the location delta file, empty if there is none.
+    Blob delta; // Uncompressed location delta.
+    RgbaImage screenshot;
+    std::vector<std::pair<std::string, RgbaImage>> images; // Lloyd's beacon images.
+};
+
+struct PendingSave {
+    std::string path;
+    std::shared_ptr<const SaveSnapshot> snapshot;
+    std::future<Blob> result;
+};
+
+} // namespace
+
+static std::optional<PendingSave> pendingSave;
+
+static std::shared_ptr<SaveSnapshot> CaptureSaveSnapshot(bool resetWorld, std::string_view title,
+                                                         SaveGameHeader *header) {
+    // Pending save might be the source for the files that we're copying, so we need to wait for it.
+    FinishPendingSave();
+
+    std::shared_ptr<SaveSnapshot> result = std::make_shared<SaveSnapshot>();
 
     std::string currentMapName = pMapStats->pInfos[engine->_currentLoadedMapId].fileName;
 
@@ -161,35 +195,33 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
         // New game - copy ddm & dlv files.
         for (const std::string &name : pGames_LOD->ls())
             if (name.ends_with(".ddm") || name.ends_with(".dlv"))
-                lodWriter.write(name, pGames_LOD->read(name));
+                result->files.emplace_back(name, pGames_LOD->read(name));
     } else {
         // Location change - copy map data from the old save & serialize current location delta.
         for (const std::string &name : pSave_LOD->ls())
-            lodWriter.write(name, pSave_LOD->read(name));
+            result->files.emplace_back(name, pSave_LOD->read(name));
 
         currentLocationTime().last_visit = pParty->GetPlayingTime();
         CompactLayingItemsList();
 
-        Blob uncompressed;
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-            serialize(*pIndoor, &uncompressed, tags::via<IndoorDelta_MM7>);
+            serialize(*pIndoor, &result->delta, tags::via<IndoorDelta_MM7>);
         } else {
             assert(uCurrentlyLoadedLevelType == LEVEL_OUTDOOR);
-            serialize(*pOutdoor, &uncompressed, tags::via<OutdoorDelta_MM7>);
+            serialize(*pOutdoor, &result->delta, tags::via<OutdoorDelta_MM7>);
         }
 
-        std::string file_name = currentMapName;
-        size_t pos = file_name.find_last_of(".");
-        file_name[pos + 1] = 'd';
-        lodWriter.write(file_name, lod::encodeCompressed(uncompressed));
+        result->deltaName = currentMapName;
+        size_t pos = result->deltaName.find_last_of(".");
+        result->deltaName[pos + 1] = 'd';
     }
 
-    lodWriter.write("image.pcx", pcx::encode(render->MakeViewportScreenshot(150, 112)));
+    result->screenshot = render->MakeViewportScreenshot(150, 112);
 
-    resultHeader.name = title;
-    resultHeader.locationName = currentMapName;
-    resultHeader.playingTime = pParty->GetPlayingTime();
-    serialize(resultHeader, &lodWriter, tags::via<SaveGame_MM7>);
+    header->name = title;
+    header->locationName = currentMapName;
+    header->playingTime = pParty->GetPlayingTime();
+    snapshot(*header, &result->save);
 
     // TODO(captainurist): incapsulate this too
     for (size_t i = 0; i < 4; ++i) {  // 4 - players
@@ -203,11 +235,30 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
             if (beacon.uBeaconTime.isValid() && image != nullptr) {
                 assert(image->rgba());
                 std::string str = fmt::format("lloyd{}{}.pcx", i + 1, j + 1);
-                lodWriter.write(str, pcx::encode(image->rgba()));
+                result->images.emplace_back(str, RgbaImage::copy(image->rgba()));
             }
         }
     }
 
+    return result;
+}
+
+static Blob BuildSaveData(const SaveSnapshot &snapshot) {
+    Blob result;
+    BlobOutputStream lodStream(&result);
+    LodWriter lodWriter(&lodStream, makeSaveLodInfo());
+
+    for (const auto &[name, file] : snapshot.files)
+        lodWriter.write(name, file);
+    if (!snapshot.deltaName.empty())
+        lodWriter.write(snapshot.deltaName, lod::encodeCompressed(snapshot.delta));
+
+    lodWriter.write("image.pcx", pcx::encode(snapshot.screenshot));
+    serialize(snapshot.save, &lodWriter);
+
+    for (const auto &[name, image] : snapshot.images)
+        lodWriter.write(name, pcx::encode(image));
+
     // Apparently vanilla had two bugs canceling each other out:
     // 1. Broken binary search implementation when looking up LOD entries.
     // 2. Writing additional duplicate entry at the end of a saves LOD file.
@@ -218,6 +269,13 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
     return result;
 }
 
+std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title) {
+    std::pair<SaveGameHeader, Blob> result;
+    auto &[resultHeader, resultBlob] = result;
+    resultBlob = BuildSaveData(*CaptureSaveSnapshot(resetWorld, title, &resultHeader));
+    return result;
+}
+
 SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path, std::string_view title) {
     assert(isAutoSave || !title.empty());
     assert(engine->_currentLoadedMapId != MAP_ARENA || isAutoSave); // No manual saves in Arena.
@@ -240,13 +298,54 @@ SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path,
     //    render->Present();
     //}
 
-    auto [header, blob] = CreateSaveData(resetWorld, title);
+    // Snapshot is taken right away, and the rest happens on a worker thread. Results are picked up in
+    // FinishPendingSave.
+    SaveGameHeader header;
+    std::shared_ptr<const SaveSnapshot> snapshot = CaptureSaveSnapshot(resetWorld, title, &header);
 
-    ufs->write(path, blob);
+    pendingSave.emplace();
+    pendingSave->path = path;
+    pendingSave->snapshot = snapshot;
+    pendingSave->result = std::async(std::launch::async, [snapshot] { return BuildSaveData(*snapshot); });
+
+    return header;
+}
+
+void FinishPendingSave() {
+    if (!pendingSave)
+        return;
+
+    PendingSave save = std::move(*pendingSave);
+    pendingSave.reset();
+
+    Blob blob;
+    try {
+        blob = save.result.get();
+        ufs->write(save.path, blob);
+    } catch (const std::exception &e) {
+        logger->error("Failed to save game to '{}': {}", save.path, e.what());
+        engine->_statusBar->setEvent(fmt::format("Failed to save game: {}", e.what()));
+        pAudioPlayer->playUISound(SOUND_error);
+        if (!blob)
+            return; // Keep the old save open, it's the best we have.
+    }
 
     pSave_LOD->open(std::move(blob), LOD_ALLOW_DUPLICATES);
+}
+
+Blob ReadLocationDelta(std::string_view name) {
+    if (pendingSave) {
+        // The save that's being written is the source of truth, but we don't need to wait for it.
+        const SaveSnapshot &snapshot = *pendingSave->snapshot;
+        if (ascii::noCaseEquals(snapshot.deltaName, name))
+            return Blob::share(snapshot.delta);
+        for (const auto &[fileName, file] : snapshot.files)
+            if (ascii::noCaseEquals(fileName, name))
+                return lod::decodeCompressed(file);
+        throw Exception("Entry '{}' doesn't exist in save '{}'", name, pendingSave->path);
+    }
 
-    return std::move(header);
+    return lod::decodeCompressed(pSave_LOD->read(name));
 }
 
 void AutoSave() {
@@ -277,6 +376,7 @@ void DoSavegame(int uSlot) {
 }
 
 void SavegameList::Initialize() {
+    FinishPendingSave(); // So that we see the file that's being written.
     pSavegameList->Reset();
 
     if (ufs->exists("saves")) {
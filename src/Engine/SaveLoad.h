@@ -37,7 +37,31 @@ struct SavegameList {
 
 void LoadGame(int uSlot);
 std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title);
+
+/**
+ * Saves the game. Game state is captured right away, but compression, LOD assembly and writing to disk are done
+ * asynchronously, and are finalized in `FinishPendingSave`.
+ *
+ * @return                              Header of the save.
+ */
 SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path, std::string_view title = {});
+
+/**
+ * Waits for the save started by `SaveGame` to complete, writes it to disk and reopens `pSave_LOD`. Errors are
+ * reported to the user and logged. Does nothing if there is no pending save.
+ *
+ * Must be called on the game thread.
+ */
+void FinishPendingSave();
+
+/**
+ * @param name                          Name of the location delta file, e.g. "d01.dlv".
+ * @return                              Uncompressed location delta from the current save. If there is a pending save,
+ *                                      it's used as the source without waiting for it to complete.
+ * @throw Exception                     If the file doesn't exist.
+ */
+Blob ReadLocationDelta(std::string_view name);
+
 void AutoSave();
 void DoSavegame(int uSlot);
 bool Initialize_GamesLOD_NewLOD();
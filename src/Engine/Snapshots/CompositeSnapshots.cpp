@@ -590,6 +590,7 @@ void deserialize(const LodReader &src, SaveGame_MM7 *dst) {
 void reconstruct(const SpriteFrameTable_MM7 &src, SpriteFrameTable *dst) {
     reconstruct(src.frames, &dst->pSpriteSFrames);
     reconstruct(src.eframes, &dst->pSpriteEFrames);
+    dst->rebuildNameIndex();
 }
 
 void deserialize(InputStream &src, SpriteFrameTable_MM7 *dst) {
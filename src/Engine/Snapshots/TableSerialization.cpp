@@ -47,6 +47,8 @@ void deserialize(const TriBlob &src, DecorationList *dst) {
         deserialize(src.mm8, &dst->pDecorations, tags::append, tags::via<DecorationDesc_MM7>);
 
     assert(!dst->pDecorations.empty());
+
+    dst->rebuildNameIndex();
 }
 
 void deserialize(const TriBlob &src, IconFrameTable *dst) {
@@ -55,6 +57,8 @@ void deserialize(const TriBlob &src, IconFrameTable *dst) {
     dst->_textures.resize(dst->_frames.size());
 
     assert(!dst->_frames.empty());
+
+    dst->rebuildNameIndex();
 }
 
 void deserialize(const TriBlob &src, MonsterList *dst) {
@@ -107,6 +111,8 @@ void deserialize(const TriBlob &src, TextureFrameTable *dst) {
     deserialize(src.mm7, &dst->textures, tags::append, tags::via<TextureFrame_MM7>);
 
     assert(!dst->textures.empty());
+
+    dst->rebuildNameIndex();
 }
 
 void deserialize(const TriBlob &src, SoundList *dst) {
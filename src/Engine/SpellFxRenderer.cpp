@@ -22,6 +22,8 @@
 
 #include "Engine/Tables/IconFrameTable.h"
 
+#include "Utility/String/NameAtom.h"
+
 //----- (004A7063) --------------------------------------------------------
 Color ModulateColor(Color diffuse, float multiplier) {
     float alpha = multiplier * diffuse.a;
@@ -1108,6 +1110,12 @@ void SpellFxRenderer::SetPartyBuffAnim(SpellId uSpellID) {
     }
 }
 
+// Looked up every frame while prismatic light is active, so the name is resolved into an atom only once.
+static int prismaticLightSpriteId() {
+    static const NameAtom spriteName("spell84");
+    return pSpriteFrameTable->FastFindSprite(spriteName);
+}
+
 //----- (004A8BDF) --------------------------------------------------------
 void SpellFxRenderer::FadeScreen__like_Turn_Undead_and_mb_Armageddon(Color uDiffuseColor, Duration uFadeTime) {
     this->uFadeTime = uFadeTime;
@@ -1117,10 +1125,7 @@ void SpellFxRenderer::FadeScreen__like_Turn_Undead_and_mb_Armageddon(Color uDiff
 
 //----- (004A8BFC) --------------------------------------------------------
 void SpellFxRenderer::_4A8BFC_prismatic_light() {  // for SPELL_LIGHT_PRISMATIC_LIGHT
-    uAnimLength =
-        pSpriteFrameTable
-                ->pSpriteSFrames[pSpriteFrameTable->FastFindSprite("spell84")]
-                .uAnimLength;
+    uAnimLength = pSpriteFrameTable->pSpriteSFrames[prismaticLightSpriteId()].uAnimLength;
 }
 
 //----- (004A8C27) --------------------------------------------------------
@@ -1149,8 +1154,9 @@ void SpellFxRenderer::RenderSpecialEffects() {
 
     if (uAnimLength > 0_ticks) {
         // prismatic light
-        animElapsed = pSpriteFrameTable->pSpriteSFrames[pSpriteFrameTable->FastFindSprite("spell84")].uAnimLength - uAnimLength;
-        prismaticFrame = pSpriteFrameTable->GetFrame(pSpriteFrameTable->FastFindSprite("spell84"), animElapsed);
+        int prismaticSpriteId = prismaticLightSpriteId();
+        animElapsed = pSpriteFrameTable->pSpriteSFrames[prismaticSpriteId].uAnimLength - uAnimLength;
+        prismaticFrame = pSpriteFrameTable->GetFrame(prismaticSpriteId, animElapsed);
         int pal = prismaticFrame->GetPaletteIndex();
         uAnimLength -= pEventTimer->dt();
 
@@ -736,6 +736,7 @@ void CastSpellInfoHelpers::castSpell() {
                         item->enchantmentExpirationTime = pParty->GetPlayingTime() + Duration::fromHours(spell_level);
                         item->flags |= ITEM_TEMP_BONUS;
                     }
+                    pParty->pCharacters[pCastSpell->targetCharacterIndex].invalidateStatCache(); // Item might be equipped.
 
                     ItemEnchantmentTimer = Duration::fromRealtimeSeconds(2);
                     break;
@@ -1534,6 +1535,8 @@ void CastSpellInfoHelpers::castSpell() {
                         }
                     }
 
+                    pTargetPlayer->invalidateStatCache(); // Item might be equipped, and it was either enchanted or broken.
+
                     if (spell_failed) {
                         spellFailed(pCastSpell, item_not_broken ? LSTR_SPELL_FAILED : LSTR_ITEM_IS_NOT_OF_HIGH_ENOUGH_QUALITY);
                         pParty->pCharacters[pCastSpell->targetCharacterIndex].playReaction(SPEECH_SPELL_FAILED);
@@ -2618,6 +2621,7 @@ void CastSpellInfoHelpers::castSpell() {
                     } else {
                         pPlayer->sAgeModifier = pPlayer->sAgeModifier + 10;
                     }
+                    pPlayer->invalidateStatCache();
                     recoveryTime = 5_ticks * spell_level;
                     ++pPlayer->uNumDivineInterventionCastsThisDay;
                     break;
@@ -10,6 +10,7 @@
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Random/Random.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/CharacterStatCache.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/SpellFxRenderer.h"
@@ -439,6 +440,7 @@ void SpellBuff::Reset() {
     expireTime = Time();
     caster = 0;
     isGMBuff = false;
+    CharacterStatCache::invalidateAll();
     if (overlayID) {
         pActiveOverlayList->pOverlays[overlayID - 1].Reset();
         overlayID = 0;
@@ -451,6 +453,7 @@ bool SpellBuff::IsBuffExpiredToTime(Time time) {
         power = 0;
         skillMastery = MASTERY_NONE;
         overlayID = 0;
+        CharacterStatCache::invalidateAll();
         return true;
     }
     return false;
@@ -475,6 +478,7 @@ bool SpellBuff::Apply(Time expire_time, Mastery uSkillMastery,
     }
     this->overlayID = uOverlayID;
     this->caster = caster;
+    CharacterStatCache::invalidateAll();
 
     return true;
 }
@@ -496,12 +500,12 @@ void SpellStats::Initialize(const Blob &spells) {
 
     std::string txtRaw(spells.string_view());
 
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     for (SpellId uSpellID : allRegularSpells()) {
         if (((std::to_underlying(uSpellID) % 11) - 1) == 0) {
-            strtok(NULL, "\r");
+            threadSafeStrtok(NULL, "\r");
         }
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
 
         auto tokens = tokenize(test_string, '\t');
 
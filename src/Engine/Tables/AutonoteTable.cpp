@@ -6,6 +6,7 @@
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Ascii.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 std::array<AutonoteData, 196> pAutonoteTxt;
 
@@ -18,10 +19,10 @@ void initializeAutonotes(const Blob &autonotes) {
     int decode_step;
 
     std::string txtRaw(autonotes.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     for (int i = 1; i < pAutonoteTxt.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
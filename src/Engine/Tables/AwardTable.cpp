@@ -5,6 +5,7 @@
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 std::array<AwardData, 105> pAwards;
 
@@ -17,10 +18,10 @@ void initializeAwards(const Blob &awards) {
     int decode_step;
 
     std::string txtRaw(awards.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     for (int i = 1; i < pAwards.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/String/Split.h"
 
 FactionTable *pFactionTable;
 
@@ -22,9 +23,9 @@ void FactionTable::Initialize(const Blob &factions) {
         line.fill(HOSTILITY_FRIENDLY);
 
     std::string txtRaw(factions.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     for (i = 0; i < 89; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -14,14 +14,14 @@ void HistoryTable::Initialize(const Blob &history) {
     char *test_string;
 
     std::string txtRaw(history.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     historyLines[0].pText = "";
     historyLines[0].pPageTitle = "";
     historyLines[0].uTime = 0;
 
     for (int i = 0; i < 28; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(test_string, '\t');
 
         historyLines[i + 1].pText = removeQuotes(tokens[1]);
@@ -8,6 +8,7 @@
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Ascii.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 IndexedArray<HouseData, HOUSE_FIRST, HOUSE_LAST> houseTable;
 
@@ -20,11 +21,11 @@ void initializeHouses(const Blob &houses) {
     int decode_step;
 
     std::string txtRaw(houses.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
 
     for (HouseId houseId : allHouses()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
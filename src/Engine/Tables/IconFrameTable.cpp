@@ -4,15 +4,16 @@
 
 #include "Engine/AssetsManager.h"
 
-#include "Utility/String/Ascii.h"
+#include "Utility/MapAccess.h"
 
 IconFrameTable *pIconsFrameTable = nullptr;
 
 int IconFrameTable::animationId(std::string_view animationName) const {
-    for (size_t i = 0; i < _frames.size(); i++)
-        if (ascii::noCaseEquals(animationName, this->_frames[i].animationName))
-            return i;
-    return -1;
+    return animationId(NameAtom(animationName));
+}
+
+int IconFrameTable::animationId(NameAtom animationName) const {
+    return valueOr(_animationIdByName, animationName, -1);
 }
 
 Duration IconFrameTable::animationLength(int animationId) const {
@@ -37,6 +38,12 @@ GraphicsImage *IconFrameTable::animationFrame(int animationId, Duration frameTim
     return loadTexture(i);
 }
 
+void IconFrameTable::rebuildNameIndex() {
+    _animationIdByName.clear();
+    for (size_t i = 0; i < _frames.size(); i++)
+        _animationIdByName.emplace(NameAtom(_frames[i].animationName), i); // First one wins.
+}
+
 GraphicsImage *IconFrameTable::loadTexture(int frameId) {
     assert(_textures.size() == _frames.size());
 
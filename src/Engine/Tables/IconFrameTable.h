@@ -1,17 +1,21 @@
 #pragma once
 
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Data/IconFrameData.h"
 #include "Engine/Time/Duration.h"
 
+#include "Utility/String/NameAtom.h"
+
 class GraphicsImage;
 struct TriBlob;
 
 class IconFrameTable {
  public:
     int animationId(std::string_view animationName) const; // By animation name.
+    int animationId(NameAtom animationName) const;
     Duration animationLength(int animationId) const;
     GraphicsImage *animationFrame(int animationId, Duration frameTime);
 
@@ -20,9 +24,15 @@ class IconFrameTable {
  private:
     GraphicsImage *loadTexture(int frameId);
 
+    /**
+     * Rebuilds the name index used by `animationId`. Must be called after `_frames` was changed.
+     */
+    void rebuildNameIndex();
+
  private:
     std::vector<IconFrameData> _frames;
     std::vector<GraphicsImage *> _textures;
+    std::unordered_map<NameAtom, int> _animationIdByName;
 };
 
 extern IconFrameTable *pIconsFrameTable;
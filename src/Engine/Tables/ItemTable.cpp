@@ -13,9 +13,11 @@
 #include "Engine/EngineFileSystem.h"
 #include "Engine/Party.h"
 #include "Engine/GameResourceManager.h"
+#include "Engine/LodRegistry.h"
 
 #include "GUI/UI/UIHouses.h"
 
+#include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/Logger/Logger.h"
 
@@ -26,7 +28,7 @@
 
 static void strtokSkipLines(int n) {
     for (int i = 0; i < n; ++i) {
-        (void)strtok(NULL, "\r");
+        (void)threadSafeStrtok(NULL, "\r");
     }
 }
 
@@ -85,12 +87,12 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     std::string txtRaw;
 
     txtRaw = resourceManager->getEventsFile("stditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     strtokSkipLines(3);
     // Standard Bonuses by Group
     standardEnchantmentChanceSumByItemType.fill(0);
     for (Attribute i : allEnchantableAttributes()) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         standardEnchantments[i].attributeName = removeQuotes(tokens[0]);
         standardEnchantments[i].itemSuffix = removeQuotes(tokens[1]);
@@ -105,17 +107,17 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     // Bonus range for Standard by Level
     strtokSkipLines(5);
     for (ItemTreasureLevel i : standardEnchantmentRangeByTreasureLevel.indices()) {  // counted from 1
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() == 4 && "Invalid number of tokens");
         standardEnchantmentRangeByTreasureLevel[i] = Segment(atoi(tokens[2]), atoi(tokens[3]));
     }
 
     txtRaw = resourceManager->getEventsFile("spcitems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     strtokSkipLines(3);
     for (ItemEnchantment i : specialEnchantments.indices()) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() >= 17 && "Invalid number of tokens");
         specialEnchantments[i].description = removeQuotes(tokens[0]);
@@ -139,10 +141,10 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     }
 
     txtRaw = resourceManager->getEventsFile("items.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     strtokSkipLines(1);
     for (size_t line = 0; line < 799; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
 
         ItemId item_counter = ItemId(atoi(tokens[0]));
@@ -207,10 +209,10 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     }
 
     txtRaw = resourceManager->getEventsFile("rnditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     strtokSkipLines(3);
     for(size_t line = 0; line < 618; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() > 7 && "Invalid number of tokens");
 
@@ -231,7 +233,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
 
     strtokSkipLines(5);
     for (int i = 0; i < 3; ++i) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = threadSafeStrtok(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() > 7 && "Invalid number of tokens");
         switch (i) {
@@ -265,6 +267,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     Item::PopulateSpecialBonusMap();
     Item::PopulateArtifactBonusMap();
     LoadItemSizes();
+    BuildSamplers();
 }
 
 //----- (00453B3C) --------------------------------------------------------
@@ -275,11 +278,11 @@ void ItemTable::LoadPotions(const Blob &potions) {
 
     std::vector<char *> tokens;
     std::string txtRaw(potions.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
+    test_string = threadSafeStrtok(txtRaw.data(), "\r") + 1;
     while (test_string) {
         tokens = tokenize(test_string, '\t');
         if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
     }
     if (!test_string) {
         logger->error("Error Pre-Parsing Potion Table");
@@ -302,7 +305,7 @@ void ItemTable::LoadPotions(const Blob &potions) {
             this->potionCombination[row][column] = potion_value;
         }
 
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         if (!test_string) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), 0);
             return;
@@ -319,11 +322,11 @@ void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
 
     std::vector<char *> tokens;
     std::string txtRaw(potionNotes.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
+    test_string = threadSafeStrtok(txtRaw.data(), "\r") + 1;
     while (test_string) {
         tokens = tokenize(test_string, '\t');
         if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
     }
     if (!test_string) {
         logger->error("Error Pre-Parsing Potion Table");
@@ -341,7 +344,7 @@ void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
             this->potionNotes[row][column] = atoi(currValue);
         }
 
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         if (!test_string) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
             return;
@@ -354,153 +357,181 @@ void ItemTable::LoadItemSizes() {
     // Item sizes are loaded at startup directly from LOD image headers. This would have been an overkill back in 1999
     // (think about all these random reads from your HDD) but is totally fine today. Another option would've been to
     // precalculate these and place in a json file, but why precalculate what's cheap to recalculate?
-    LodReader reader(dfs->read("data/icons.lod"));
+    const LodReader *reader = pLodRegistry->open("data/icons.lod");
 
     for (ItemId itemId : items.indices()) {
         std::string iconName = items[itemId].iconName;
 
         Sizei iconSize(1, 1); // Actual icon name that will be used in this case is "pending", see LodTextureCache.
-        if (reader.exists(iconName))
-            iconSize = lod::decodeImageSize(reader.read(iconName));
+        if (reader->exists(iconName))
+            iconSize = lod::decodeImageSize(reader->read(iconName));
 
         itemSizes[itemId] = Sizei(GetSizeInInventorySlots(iconSize.w), GetSizeInInventorySlots(iconSize.h));
     }
 }
 
-void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTreasureType, Item *outItem) {
-    assert(isRandomTreasureLevel(treasureLevel));
+static void resolveRandomItemType(RandomItemType type, ItemType *requestedEquip, Skill *requestedSkill) {
+    *requestedSkill = SKILL_INVALID;
+    switch (type) {
+        case RANDOM_ITEM_WEAPON:
+            *requestedEquip = ITEM_TYPE_SINGLE_HANDED;
+            break;
+        case RANDOM_ITEM_ARMOR:
+            *requestedEquip = ITEM_TYPE_ARMOUR;
+            break;
+        case RANDOM_ITEM_MICS:
+            *requestedSkill = SKILL_MISC;
+            break;
+        case RANDOM_ITEM_SWORD:
+            *requestedSkill = SKILL_SWORD;
+            break;
+        case RANDOM_ITEM_DAGGER:
+            *requestedSkill = SKILL_DAGGER;
+            break;
+        case RANDOM_ITEM_AXE:
+            *requestedSkill = SKILL_AXE;
+            break;
+        case RANDOM_ITEM_SPEAR:
+            *requestedSkill = SKILL_SPEAR;
+            break;
+        case RANDOM_ITEM_BOW:
+            *requestedSkill = SKILL_BOW;
+            break;
+        case RANDOM_ITEM_MACE:
+            *requestedSkill = SKILL_MACE;
+            break;
+        case RANDOM_ITEM_CLUB:
+            *requestedSkill = SKILL_CLUB;
+            break;
+        case RANDOM_ITEM_STAFF:
+            *requestedSkill = SKILL_STAFF;
+            break;
+        case RANDOM_ITEM_LEATHER_ARMOR:
+            *requestedSkill = SKILL_LEATHER;
+            break;
+        case RANDOM_ITEM_CHAIN_ARMOR:
+            *requestedSkill = SKILL_CHAIN;
+            break;
+        case RANDOM_ITEM_PLATE_ARMOR:
+            *requestedSkill = SKILL_PLATE;
+            break;
+        case RANDOM_ITEM_SHIELD:
+            *requestedEquip = ITEM_TYPE_SHIELD;
+            break;
+        case RANDOM_ITEM_HELMET:
+            *requestedEquip = ITEM_TYPE_HELMET;
+            break;
+        case RANDOM_ITEM_BELT:
+            *requestedEquip = ITEM_TYPE_BELT;
+            break;
+        case RANDOM_ITEM_CLOAK:
+            *requestedEquip = ITEM_TYPE_CLOAK;
+            break;
+        case RANDOM_ITEM_GAUNTLETS:
+            *requestedEquip = ITEM_TYPE_GAUNTLETS;
+            break;
+        case RANDOM_ITEM_BOOTS:
+            *requestedEquip = ITEM_TYPE_BOOTS;
+            break;
+        case RANDOM_ITEM_RING:
+            *requestedEquip = ITEM_TYPE_RING;
+            break;
+        case RANDOM_ITEM_AMULET:
+            *requestedEquip = ITEM_TYPE_AMULET;
+            break;
+        case RANDOM_ITEM_WAND:
+            *requestedEquip = ITEM_TYPE_WAND;
+            break;
+        case RANDOM_ITEM_SPELL_SCROLL:
+            *requestedEquip = ITEM_TYPE_SPELL_SCROLL;
+            break;
+        case RANDOM_ITEM_POTION:
+            *requestedEquip = ITEM_TYPE_POTION;
+            break;
+        case RANDOM_ITEM_REAGENT:
+            *requestedEquip = ITEM_TYPE_REAGENT;
+            break;
+        case RANDOM_ITEM_GEM:
+            *requestedEquip = ITEM_TYPE_GEM;
+            break;
+        default:
+            // TODO(captainurist): explore
+            *requestedEquip = static_cast<ItemType>(std::to_underlying(type) - 1);
+            break;
+    }
+}
 
-    std::vector<ItemId> possibleItems;
-    std::vector<ItemEnchantment> possibleEnchantments;
-    std::vector<int> cumulativeWeights;
-    int weightSum = 0;
+static WeightedSampler<ItemId> buildItemSampler(const IndexedArray<ItemData, ITEM_FIRST_VALID, ITEM_LAST_VALID> &items,
+                                                ItemTreasureLevel treasureLevel, RandomItemType type) {
+    ItemType requestedEquip = {};
+    Skill requestedSkill;
+    resolveRandomItemType(type, &requestedEquip, &requestedSkill);
+
+    WeightedSampler<ItemId> result;
+    for (ItemId itemId : allSpawnableItems()) {
+        bool matches = requestedSkill == SKILL_INVALID ? items[itemId].type == requestedEquip
+                                                       : items[itemId].skill == requestedSkill;
+        if (matches)
+            result.add(itemId, items[itemId].uChanceByTreasureLvl[treasureLevel]);
+    }
+    result.finalize();
+    return result;
+}
 
-    assert(outItem != NULL);
-    *outItem = Item();
+void ItemTable::BuildSamplers() {
+    for (ItemTreasureLevel treasureLevel : itemSamplers.indices()) {
+        for (RandomItemType type : allSpawnableRandomItemTypes())
+            itemSamplers[treasureLevel][type] = buildItemSampler(items, treasureLevel, type);
 
-    if (uTreasureType != RANDOM_ITEM_ANY) {  // generate known treasure type
-        ItemType requestedEquip;
-        Skill requestedSkill = SKILL_INVALID;
-        switch (uTreasureType) {
-            case RANDOM_ITEM_WEAPON:
-                requestedEquip = ITEM_TYPE_SINGLE_HANDED;
-                break;
-            case RANDOM_ITEM_ARMOR:
-                requestedEquip = ITEM_TYPE_ARMOUR;
-                break;
-            case RANDOM_ITEM_MICS:
-                requestedSkill = SKILL_MISC;
-                break;
-            case RANDOM_ITEM_SWORD:
-                requestedSkill = SKILL_SWORD;
-                break;
-            case RANDOM_ITEM_DAGGER:
-                requestedSkill = SKILL_DAGGER;
-                break;
-            case RANDOM_ITEM_AXE:
-                requestedSkill = SKILL_AXE;
-                break;
-            case RANDOM_ITEM_SPEAR:
-                requestedSkill = SKILL_SPEAR;
-                break;
-            case RANDOM_ITEM_BOW:
-                requestedSkill = SKILL_BOW;
-                break;
-            case RANDOM_ITEM_MACE:
-                requestedSkill = SKILL_MACE;
-                break;
-            case RANDOM_ITEM_CLUB:
-                requestedSkill = SKILL_CLUB;
-                break;
-            case RANDOM_ITEM_STAFF:
-                requestedSkill = SKILL_STAFF;
-                break;
-            case RANDOM_ITEM_LEATHER_ARMOR:
-                requestedSkill = SKILL_LEATHER;
-                break;
-            case RANDOM_ITEM_CHAIN_ARMOR:
-                requestedSkill = SKILL_CHAIN;
-                break;
-            case RANDOM_ITEM_PLATE_ARMOR:
-                requestedSkill = SKILL_PLATE;
-                break;
-            case RANDOM_ITEM_SHIELD:
-                requestedEquip = ITEM_TYPE_SHIELD;
-                break;
-            case RANDOM_ITEM_HELMET:
-                requestedEquip = ITEM_TYPE_HELMET;
-                break;
-            case RANDOM_ITEM_BELT:
-                requestedEquip = ITEM_TYPE_BELT;
-                break;
-            case RANDOM_ITEM_CLOAK:
-                requestedEquip = ITEM_TYPE_CLOAK;
-                break;
-            case RANDOM_ITEM_GAUNTLETS:
-                requestedEquip = ITEM_TYPE_GAUNTLETS;
-                break;
-            case RANDOM_ITEM_BOOTS:
-                requestedEquip = ITEM_TYPE_BOOTS;
-                break;
-            case RANDOM_ITEM_RING:
-                requestedEquip = ITEM_TYPE_RING;
-                break;
-            case RANDOM_ITEM_AMULET:
-                requestedEquip = ITEM_TYPE_AMULET;
-                break;
-            case RANDOM_ITEM_WAND:
-                requestedEquip = ITEM_TYPE_WAND;
-                break;
-            case RANDOM_ITEM_SPELL_SCROLL:
-                requestedEquip = ITEM_TYPE_SPELL_SCROLL;
-                break;
-            case RANDOM_ITEM_POTION:
-                requestedEquip = ITEM_TYPE_POTION;
-                break;
-            case RANDOM_ITEM_REAGENT:
-                requestedEquip = ITEM_TYPE_REAGENT;
-                break;
-            case RANDOM_ITEM_GEM:
-                requestedEquip = ITEM_TYPE_GEM;
-                break;
-            default:
-                assert(false);  // check this condition
-                // TODO(captainurist): explore
-                requestedEquip = static_cast<ItemType>(std::to_underlying(uTreasureType) - 1);
-                break;
-        }
+        WeightedSampler<ItemId> &anySampler = anyItemSamplers[treasureLevel];
+        for (ItemId itemId : allSpawnableItems())
+            anySampler.add(itemId, items[itemId].uChanceByTreasureLvl[treasureLevel]);
+        anySampler.finalize();
+    }
 
-        if (requestedSkill == SKILL_INVALID) {  // no skill for this item needed
-            for (ItemId itemId : allSpawnableItems()) {
-                if (items[itemId].type == requestedEquip) {
-                    if (items[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += items[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
-                }
-            }
-        } else {  // have needed skill
-            for (ItemId itemId : allSpawnableItems()) {
-                if (items[itemId].skill == requestedSkill) {
-                    if (items[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += items[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
+    for (ItemType type : standardEnchantmentSamplers.indices()) {
+        for (Attribute attr : allEnchantableAttributes())
+            standardEnchantmentSamplers[type].add(attr, standardEnchantments[attr].chanceByItemType[type]);
+        standardEnchantmentSamplers[type].finalize();
+    }
+
+    for (ItemTreasureLevel treasureLevel : specialEnchantmentSamplers.indices()) {
+        for (ItemType type : specialEnchantmentSamplers[treasureLevel].indices()) {
+            WeightedSampler<ItemEnchantment> &sampler = specialEnchantmentSamplers[treasureLevel][type];
+            for (ItemEnchantment ench : specialEnchantments.indices()) {
+                int tr_lv = (specialEnchantments[ench].iTreasureLevel) & 3;
+
+                // tr_lv  0 = treasure level 3/4
+                // tr_lv  1 = treasure level 3/4/5
+                // tr_lv  2 = treasure level 4/5
+                // tr_lv  3 = treasure level 5/6
+
+                if ((treasureLevel == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
+                    (treasureLevel == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
+                    (treasureLevel == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
+                    (treasureLevel == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3)) {
+                    sampler.add(ench, specialEnchantments[ench].chanceByItemType[type]);
                 }
             }
+            sampler.finalize();
         }
+    }
+}
 
-        if (weightSum) {
-            int pickedWeight = grng->random(weightSum) + 1;
-            auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
+void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTreasureType, Item *outItem) {
+    assert(isRandomTreasureLevel(treasureLevel));
 
-            assert(foundWeight != cumulativeWeights.end());
+    assert(outItem != NULL);
+    *outItem = Item();
 
-            outItem->itemId = possibleItems[std::distance(cumulativeWeights.begin(), foundWeight)];
+    if (uTreasureType != RANDOM_ITEM_ANY) {  // generate known treasure type
+        if (isSpawnableRandomItemType(uTreasureType)) {
+            const WeightedSampler<ItemId> &sampler = itemSamplers[treasureLevel][uTreasureType];
+            outItem->itemId = sampler.empty() ? ITEM_CRUDE_LONGSWORD : sampler.sample(grng);
         } else {
-            outItem->itemId = ITEM_CRUDE_LONGSWORD;
+            assert(false);  // check this condition
+            WeightedSampler<ItemId> sampler = buildItemSampler(items, treasureLevel, uTreasureType);
+            outItem->itemId = sampler.empty() ? ITEM_CRUDE_LONGSWORD : sampler.sample(grng);
         }
     } else {
         // Trying to generate artifact
@@ -519,14 +550,10 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
         }
 
         // Otherwise try to spawn any random item
+        // Note that the roll is over all items, not only spawnable ones, so it might not hit anything.
         int randomWeight = grng->random(this->itemChanceSumByTreasureLevel[treasureLevel]) + 1;
-        for (ItemId itemId : allSpawnableItems()) {
-            weightSum += items[itemId].uChanceByTreasureLvl[treasureLevel];
-            if (weightSum >= randomWeight) {
-                outItem->itemId = itemId;
-                break;
-            }
-        }
+        if (randomWeight <= anyItemSamplers[treasureLevel].totalWeight())
+            outItem->itemId = anyItemSamplers[treasureLevel].sampleByWeight(randomWeight);
     }
     if (outItem->isPotion() && outItem->itemId != ITEM_POTION_BOTTLE) {  // if it potion set potion spec
         outItem->potionPower = grng->randomDice(2, 4) * std::to_underlying(treasureLevel);
@@ -564,16 +591,7 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
                 return;
             int bonusChanceRoll = grng->random(100);
             if (bonusChanceRoll < standardEnchantmentChanceForEquipment[treasureLevel]) {
-                int enchantmentChanceSumRoll = grng->random(standardEnchantmentChanceSumByItemType[outItem->type()]) + 1;
-                int currentEnchantmentChancesSum = 0;
-                for (Attribute attr : allEnchantableAttributes()) {
-                    if (currentEnchantmentChancesSum >= enchantmentChanceSumRoll)
-                        break;
-
-                    currentEnchantmentChancesSum += standardEnchantments[attr].chanceByItemType[outItem->type()];
-                    outItem->standardEnchantment = attr;
-                }
-                assert(outItem->standardEnchantment);
+                outItem->standardEnchantment = standardEnchantmentSamplers[outItem->type()].sample(grng);
 
                 outItem->standardEnchantmentStrength = grng->randomSample(standardEnchantmentRangeByTreasureLevel[treasureLevel]);
                 Attribute standardEnchantmentAttributeSkill = *outItem->standardEnchantment;
@@ -600,31 +618,7 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
             return;
     }
 
-    cumulativeWeights.clear();
-    weightSum = 0;
-    for (ItemEnchantment ench : specialEnchantments.indices()) {
-        int tr_lv = (specialEnchantments[ench].iTreasureLevel) & 3;
-
-        // tr_lv  0 = treasure level 3/4
-        // tr_lv  1 = treasure level 3/4/5
-        // tr_lv  2 = treasure level 4/5
-        // tr_lv  3 = treasure level 5/6
-
-        if ((treasureLevel == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3)) {
-            int spc = specialEnchantments[ench].chanceByItemType[outItem->type()];
-            if (spc) {
-                weightSum += spc;
-                possibleEnchantments.push_back(ench);
-                cumulativeWeights.push_back(weightSum);
-            }
-        }
-    }
-
-    int pickedWeight = grng->random(weightSum) + 1;
-    auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
-    assert(foundWeight != cumulativeWeights.end());
-    outItem->specialEnchantment = possibleEnchantments[std::distance(cumulativeWeights.begin(), foundWeight)];
+    const WeightedSampler<ItemEnchantment> &sampler = specialEnchantmentSamplers[treasureLevel][outItem->type()];
+    assert(!sampler.empty());
+    outItem->specialEnchantment = sampler.sample(grng);
 }
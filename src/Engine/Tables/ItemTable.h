@@ -8,6 +8,7 @@
 #include "Engine/Objects/Item.h"
 
 #include "Library/Geometry/Size.h"
+#include "Library/Random/WeightedSampler.h"
 
 #include "Utility/IndexedArray.h"
 #include "Utility/Segment.h"
@@ -20,6 +21,7 @@ struct ItemTable {
     void LoadPotions(const Blob &potions);
     void LoadPotionNotes(const Blob &potionNotes);
     void LoadItemSizes();
+    void BuildSamplers();
 
     /**
      * @offset 0x456620
@@ -77,6 +79,19 @@ struct ItemTable {
 
     /** Ranges of standard enchantment strength by item treasure level. */
     IndexedArray<Segment<int>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> standardEnchantmentRangeByTreasureLevel;
+
+    /** Precomputed samplers for spawnable items of the given random item type, by treasure level. */
+    IndexedArray<IndexedArray<WeightedSampler<ItemId>, RANDOM_ITEM_FIRST_SPAWNABLE, RANDOM_ITEM_LAST_SPAWNABLE>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> itemSamplers;
+
+    /** Precomputed samplers for all spawnable items, by treasure level. Note that the total weight of these samplers
+     * might be less than `itemChanceSumByTreasureLevel`, as the latter also counts non-spawnable items. */
+    IndexedArray<WeightedSampler<ItemId>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> anyItemSamplers;
+
+    /** Precomputed samplers for standard enchantments, by item type. */
+    IndexedArray<WeightedSampler<Attribute>, ITEM_TYPE_FIRST_NORMAL_ENCHANTABLE, ITEM_TYPE_LAST_NORMAL_ENCHANTABLE> standardEnchantmentSamplers;
+
+    /** Precomputed samplers for special enchantments, by treasure level and item type. */
+    IndexedArray<IndexedArray<WeightedSampler<ItemEnchantment>, ITEM_TYPE_FIRST_SPECIAL_ENCHANTABLE, ITEM_TYPE_LAST_SPECIAL_ENCHANTABLE>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> specialEnchantmentSamplers;
 };
 
 extern ItemTable *pItemTable;
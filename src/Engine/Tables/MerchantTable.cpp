@@ -7,6 +7,7 @@
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsBuyPhrases;
 IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsSellPhrases;
@@ -22,10 +23,10 @@ void initializeMerchants(const Blob &merchants) {
     int decode_step;
 
     std::string txtRaw(merchants.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     for (MerchantPhrase i : allMerchantPhrases()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
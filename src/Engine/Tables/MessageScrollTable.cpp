@@ -5,6 +5,7 @@
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 IndexedArray<std::string, ITEM_FIRST_MESSAGE_SCROLL, ITEM_LAST_MESSAGE_SCROLL> pMessageScrolls;
 
@@ -17,9 +18,9 @@ void initializeMessageScrolls(const Blob &scrolls) {
     int decode_step;
 
     std::string txtRaw(scrolls.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     for (ItemId i : pMessageScrolls.indices()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
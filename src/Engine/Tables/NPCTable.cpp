@@ -10,6 +10,7 @@
 #include "Engine/Random/Random.h"
 
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 std::array<NPCTopic, 789> pNPCTopics;
 NPCStats *pNPCStats = nullptr;
@@ -28,10 +29,10 @@ void NPCStats::InitializeNPCText(const Blob &npcText) {
     int decode_step;
 
     std::string txtRaw(npcText.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     for (i = 0; i < 789; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -58,7 +59,7 @@ void NPCStats::InitializeNPCText(const Blob &npcText) {
 
 void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
     std::string txtRaw(npcTopics.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -68,7 +69,7 @@ void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
     int decode_step;
 
     for (int i = 1; i <= 579; ++i) {  // NPC topics count limit
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -95,8 +96,8 @@ void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
 
 void NPCStats::InitializeNPCDist(const Blob &npcDist) {
     std::string txtRaw(npcDist.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
 
     char *test_string;
     unsigned char c;
@@ -106,7 +107,7 @@ void NPCStats::InitializeNPCDist(const Blob &npcDist) {
     int decode_step;
 
     for (int i = 1; i < 59; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -165,11 +166,11 @@ void NPCStats::InitializeNPCData(const Blob &npcData) {
     int decode_step;
 
     std::string txtRaw(npcData.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
 
     for (i = 0; i < 500; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -232,7 +233,7 @@ void NPCStats::InitializeNPCData(const Blob &npcData) {
 
 void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
     std::string txtRaw(npcGreets.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -242,7 +243,7 @@ void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
     int decode_step;
 
     for (int i = 1; i <= 205; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -273,7 +274,7 @@ void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
 
 void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
     std::string txtRaw(npcGroups.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -283,7 +284,7 @@ void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
     int decode_step;
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -309,7 +310,7 @@ void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
 
 void NPCStats::InitializeNPCNews(const Blob &npcNews) {
     std::string txtRaw(npcNews.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -319,7 +320,7 @@ void NPCStats::InitializeNPCNews(const Blob &npcNews) {
     int decode_step;
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -358,7 +359,7 @@ void NPCStats::Initialize(GameResourceManager *resourceManager) {
 
 void NPCStats::InitializeNPCNames(const Blob &npcNames) {
     std::string txtRaw(npcNames.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     int i;
     char *test_string;
@@ -371,7 +372,7 @@ void NPCStats::InitializeNPCNames(const Blob &npcNames) {
     uNewlNPCBufPos = 0;
 
     for (i = 0; i < 540; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -408,10 +409,10 @@ void NPCStats::InitializeNPCNames(const Blob &npcNames) {
 
 void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
     std::string txtRaw(npcProfs.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
+    threadSafeStrtok(NULL, "\r");
+    threadSafeStrtok(NULL, "\r");
+    threadSafeStrtok(NULL, "\r");
 
     int i;
     char *test_string;
@@ -422,7 +423,7 @@ void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
     int decode_step;
 
     for (NpcProfession i : Segment(NPC_PROFESSION_FIRST_VALID, NPC_PROFESSION_LAST_VALID)) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -5,6 +5,7 @@
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 IndexedArray<std::string, QBIT_FIRST, QBIT_LAST> pQuestTable;
 
@@ -17,10 +18,10 @@ void initializeQuests(const Blob &quests) {
     int decode_step;
 
     std::string txtRaw(quests.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
     memset(pQuestTable.data(), 0, sizeof(pQuestTable));
     for (auto i : pQuestTable.indices()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
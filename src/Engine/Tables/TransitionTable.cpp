@@ -5,6 +5,7 @@
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/String/Split.h"
 
 std::array<std::string, 465> pTransitionStrings;
 
@@ -17,11 +18,11 @@ void initializeTransitions(const Blob &transitions) {
     int decode_step;
 
     std::string txtRaw(transitions.string_view());
-    strtok(txtRaw.data(), "\r");
+    threadSafeStrtok(txtRaw.data(), "\r");
 
     pTransitionStrings[0] = "";
     for (int i = 1; i < pTransitionStrings.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = threadSafeStrtok(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
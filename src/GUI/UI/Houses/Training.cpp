@@ -69,6 +69,7 @@ void GUIWindow_Training::trainDialogue() {
                 playHouseSound(houseId(), HOUSE_SOUND_TRAINING_TRAIN);
                 pParty->activeCharacter().uLevel++;
                 pParty->activeCharacter().uSkillPoints += pParty->activeCharacter().uLevel / 10 + 5;
+                pParty->activeCharacter().invalidateStatCache();
                 pParty->activeCharacter().health = pParty->activeCharacter().GetMaxHealth();
                 pParty->activeCharacter().mana = pParty->activeCharacter().GetMaxMana();
                 int maxLevelStepsBefore = *std::max_element(_charactersTrainedLevels.begin(), _charactersTrainedLevels.end());
@@ -50,6 +50,7 @@
 #include "Io/Mouse.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Utility/String/NameAtom.h"
 
 #include "Library/Logger/Logger.h"
 
@@ -1673,10 +1674,11 @@ void GameUI_DrawHiredNPCs() {
 
             // Dark sacrifice animation.
             if (!buf.IsFollower(i) && buf.GetSacrificeStatus(i)->inProgress) {
+                static const NameAtom sacrificeAnimationName("spell96");
                 render->DrawTextureNew(
                     pHiredNPCsIconsOffsetsX[count] / 640.0f,
                     pHiredNPCsIconsOffsetsY[count] / 480.0f,
-                    pIconsFrameTable->animationFrame(pIconsFrameTable->animationId("spell96"), buf.GetSacrificeStatus(i)->elapsedTime));
+                    pIconsFrameTable->animationFrame(pIconsFrameTable->animationId(sacrificeAnimationName), buf.GetSacrificeStatus(i)->elapsedTime));
             }
         }
     }
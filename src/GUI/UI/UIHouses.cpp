@@ -1073,7 +1073,7 @@ void GUIWindow_House::learnSelectedSkill(Skill skill) {
             } else {
                 pParty->TakeGold(pPrice);
                 _transactionPerformed = true;
-                pParty->activeCharacter().pActiveSkills[skill] = CombinedSkillValue::novice();
+                pParty->activeCharacter().setSkillValue(skill, CombinedSkillValue::novice());
                 pParty->activeCharacter().playReaction(SPEECH_SKILL_LEARNED);
             }
         }
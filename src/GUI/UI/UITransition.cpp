@@ -11,6 +11,7 @@
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Image.h"
 #include "Engine/Localization.h"
+#include "Engine/LocationPrefetch.h"
 #include "Engine/MapInfo.h"
 #include "Engine/Party.h"
 #include "Engine/Time/Timer.h"
@@ -149,6 +150,11 @@ GUIWindow_IndoorEntryExit::GUIWindow_IndoorEntryExit(HouseId transitionHouse, un
 
     _mapName = locationName;
 
+    // Party is likely to go through, so start loading the destination right away. Names starting with '0' refer to
+    // the current map.
+    if (!locationName.starts_with('0'))
+        PrefetchLocation(locationName);
+
     transition_ui_icon = assets->getImage_Solid(pHouse_ExitPictures[exit_pic_id]);
 
     // animation or special transfer message
@@ -1,45 +1,102 @@
 #include "Compression.h"
 
-#include <zlib.h>
-
-#include <cstring>
+#include <cstdlib>
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <utility>
 
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Exception.h"
+
+#include "ZlibState.h"
 
 namespace zlib {
 
+// Inflate state is ~40Kb worth of allocations, so we reuse it between calls instead of re-initializing it every time.
+static detail::InflateState &threadInflateState() {
+    thread_local detail::InflateState state;
+    state.reset();
+    return state;
+}
+
 Blob compress(const Blob &source) {
-    uLongf destLen = source.size();
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
-        }
-        dest.reset(malloc(destLen));
-        res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
-    }
+    // compressBound is an upper bound on the compressed size, so a single call always succeeds.
+    uLongf destLen = compressBound(source.size());
+    std::unique_ptr<void, FreeDeleter> dest(malloc(destLen));
+    int res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+    if (res != Z_OK)
+        return Blob();
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    return Blob::fromMalloc(std::move(dest), destLen);
 }
 
 Blob uncompress(const Blob &source, size_t sizeHint) {
-    uLongf destLen = sizeHint > source.size() ? sizeHint : source.size() * 4;
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
-        }
-        dest.reset(malloc(destLen));
-        res = ::uncompress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+    z_stream &stream = threadInflateState().stream;
+    stream.next_in = const_cast<Bytef *>(static_cast<const Bytef *>(source.data()));
+    stream.avail_in = source.size();
+
+    size_t capacity = std::max<size_t>(sizeHint ? sizeHint : source.size() * 4, 1);
+    std::unique_ptr<void, FreeDeleter> dest(malloc(capacity));
+    size_t size = 0;
+    while (true) {
+        stream.next_out = static_cast<Bytef *>(dest.get()) + size;
+        stream.avail_out = capacity - size;
+        int res = inflate(&stream, Z_NO_FLUSH);
+        size = capacity - stream.avail_out;
+
+        if (res == Z_STREAM_END)
+            break;
+        if (res != Z_OK && res != Z_BUF_ERROR)
+            throw Exception("Failed to uncompress '{}': {}",
+                            source.displayPath(), stream.msg ? stream.msg : "unknown error");
+        if (stream.avail_out != 0)
+            throw Exception("Failed to uncompress '{}': data is truncated", source.displayPath());
+
+        // Out of output space, grow the buffer & continue where we left off.
+        capacity *= 2;
+        dest.reset(realloc(dest.release(), capacity));
     }
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    if (size == 0)
+        return Blob();
+    if (size != capacity)
+        dest.reset(realloc(dest.release(), size)); // Shrinking is cheap, and we don't want to hold onto extra memory.
+    return Blob::fromMalloc(std::move(dest), size);
+}
+
+size_t uncompress(const Blob &source, void *target, size_t targetSize) {
+    z_stream &stream = threadInflateState().stream;
+    stream.next_in = const_cast<Bytef *>(static_cast<const Bytef *>(source.data()));
+    stream.avail_in = source.size();
+    stream.next_out = static_cast<Bytef *>(target);
+    stream.avail_out = targetSize;
+
+    int res = inflate(&stream, Z_FINISH);
+    if (res == Z_STREAM_END)
+        return targetSize - stream.avail_out;
+
+    if (res == Z_BUF_ERROR && stream.avail_out == 0)
+        throw Exception("Uncompressed data in '{}' doesn't fit into a buffer of {} bytes",
+                        source.displayPath(), targetSize);
+    if (res == Z_BUF_ERROR)
+        throw Exception("Failed to uncompress '{}': data is truncated", source.displayPath());
+    throw Exception("Failed to uncompress '{}': {}", source.displayPath(), stream.msg ? stream.msg : "unknown error");
+}
+
+uint32_t crc32(const Blob &data, uint32_t crc) {
+    const Bytef *pos = static_cast<const Bytef *>(data.data());
+    size_t remaining = data.size();
+
+    // zlib takes uInt sizes, so blobs larger than 4Gb have to be processed in chunks.
+    do {
+        uInt chunkSize = std::min<size_t>(remaining, std::numeric_limits<uInt>::max());
+        crc = ::crc32(crc, pos, chunkSize);
+        pos += chunkSize;
+        remaining -= chunkSize;
+    } while (remaining > 0);
+
+    return crc;
 }
 
-};  // namespace zlib
+} // namespace zlib
@@ -1,8 +1,44 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "Utility/Memory/Blob.h"
 
 namespace zlib {
+
+/**
+ * @param source                        Data to compress.
+ * @return                              Zlib-compressed data, or an empty blob on error.
+ */
 Blob compress(const Blob &source);
+
+/**
+ * @param source                        Zlib-compressed data.
+ * @param sizeHint                      Expected uncompressed size, if known. If it's exact, then the output buffer is
+ *                                      allocated exactly once. If it's too small, the buffer is grown as needed.
+ * @return                              Uncompressed data.
+ * @throw Exception                     If the data is malformed or truncated.
+ */
 Blob uncompress(const Blob &source, size_t sizeHint = 0);
-};  // namespace zlib
+
+/**
+ * Uncompresses into a caller-provided buffer, e.g. one that's reused between calls.
+ *
+ * @param source                        Zlib-compressed data.
+ * @param target                        Output buffer.
+ * @param targetSize                    Size of the output buffer.
+ * @return                              Number of bytes written into the output buffer.
+ * @throw Exception                     If the data is malformed or truncated, or if it doesn't fit into the output
+ *                                      buffer.
+ */
+size_t uncompress(const Blob &source, void *target, size_t targetSize);
+
+/**
+ * @param data                          Data to checksum.
+ * @param crc                           Checksum of the preceding data, if the checksum is calculated in chunks.
+ * @return                              CRC-32 checksum of the provided data.
+ */
+uint32_t crc32(const Blob &data, uint32_t crc = 0);
+
+} // namespace zlib
@@ -0,0 +1,105 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Compression/Compression.h"
+#include "Library/Compression/ZlibInputStream.h"
+#include "Library/Compression/ZlibOutputStream.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/StringOutputStream.h"
+
+static std::string makeTestData(size_t size) {
+    std::string result;
+    for (size_t i = 0; result.size() < size; i++)
+        result += std::to_string(i * i);
+    result.resize(size);
+    return result;
+}
+
+UNIT_TEST(Compression, RoundTrip) {
+    std::string data = makeTestData(100000);
+    Blob compressed = zlib::compress(Blob::view(data));
+    EXPECT_LT(compressed.size(), data.size());
+
+    EXPECT_EQ(zlib::uncompress(compressed).string_view(), data); // No size hint.
+    EXPECT_EQ(zlib::uncompress(compressed, data.size()).string_view(), data); // Exact size hint.
+    EXPECT_EQ(zlib::uncompress(compressed, 10).string_view(), data); // Size hint that's too small.
+}
+
+UNIT_TEST(Compression, Empty) {
+    Blob compressed = zlib::compress(Blob());
+    EXPECT_FALSE(compressed.empty());
+    EXPECT_TRUE(zlib::uncompress(compressed).empty());
+}
+
+UNIT_TEST(Compression, Malformed) {
+    std::string data = makeTestData(1000);
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    EXPECT_ANY_THROW((void) zlib::uncompress(compressed.subBlob(0, compressed.size() / 2)));
+    EXPECT_ANY_THROW((void) zlib::uncompress(Blob::view(data)));
+}
+
+UNIT_TEST(Compression, CallerProvidedBuffer) {
+    std::string data = makeTestData(5000);
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    std::string buffer(10000, '\0');
+    EXPECT_EQ(zlib::uncompress(compressed, buffer.data(), buffer.size()), data.size());
+    EXPECT_EQ(buffer.substr(0, data.size()), data);
+
+    EXPECT_ANY_THROW((void) zlib::uncompress(compressed, buffer.data(), data.size() - 1));
+    EXPECT_ANY_THROW((void) zlib::uncompress(compressed.subBlob(0, 10), buffer.data(), buffer.size()));
+}
+
+UNIT_TEST(Compression, Streams) {
+    std::string data = makeTestData(300000);
+
+    std::string compressed;
+    StringOutputStream stringOutput(&compressed);
+    ZlibOutputStream zlibOutput(&stringOutput);
+    for (size_t pos = 0; pos < data.size(); pos += 777)
+        zlibOutput.write(data.substr(pos, 777));
+    zlibOutput.close();
+
+    EXPECT_EQ(zlib::uncompress(Blob::view(compressed), data.size()).string_view(), data);
+
+    BlobInputStream blobInput(Blob::view(compressed));
+    ZlibInputStream zlibInput(&blobInput);
+    EXPECT_EQ(zlibInput.skip(1000), 1000);
+    EXPECT_EQ(zlibInput.readAll(), data.substr(1000));
+    EXPECT_EQ(zlibInput.readAll(), "");
+}
+
+UNIT_TEST(Compression, StreamExactReads) {
+    // Highly compressible data, zlib consumes the input long before all of the output is produced.
+    std::string data(100000, 'a');
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    BlobInputStream blobInput(compressed);
+    ZlibInputStream zlibInput(&blobInput);
+    std::string buffer(data.size(), '\0');
+    EXPECT_EQ(zlibInput.read(buffer.data(), 1000), 1000);
+    EXPECT_EQ(zlibInput.read(buffer.data() + 1000, data.size() - 1000), data.size() - 1000);
+    EXPECT_EQ(buffer, data);
+    EXPECT_EQ(zlibInput.read(buffer.data(), 1), 0); // Only the trailer is left at this point.
+}
+
+UNIT_TEST(Compression, TruncatedStream) {
+    std::string data = makeTestData(100000);
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    BlobInputStream blobInput(compressed.subBlob(0, compressed.size() / 2));
+    ZlibInputStream zlibInput(&blobInput);
+    EXPECT_ANY_THROW((void) zlibInput.readAll());
+}
+
+UNIT_TEST(Compression, Crc32) {
+    EXPECT_EQ(zlib::crc32(Blob()), 0);
+    EXPECT_EQ(zlib::crc32(Blob::view("123456789")), 0xCBF43926);
+
+    std::string data = makeTestData(1000);
+    uint32_t crc = zlib::crc32(Blob::view(data.substr(0, 300)));
+    EXPECT_EQ(zlib::crc32(Blob::view(data.substr(300)), crc), zlib::crc32(Blob::view(data)));
+}
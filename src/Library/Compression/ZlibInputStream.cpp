@@ -0,0 +1,86 @@
+#include "ZlibInputStream.h"
+
+#include <cassert>
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "Utility/Exception.h"
+
+#include "ZlibState.h"
+
+ZlibInputStream::ZlibInputStream() = default;
+
+ZlibInputStream::ZlibInputStream(InputStream *base) {
+    open(base);
+}
+
+ZlibInputStream::~ZlibInputStream() = default;
+
+void ZlibInputStream::open(InputStream *base) {
+    assert(base);
+
+    close();
+
+    _base = base;
+    _state = std::make_unique<zlib::detail::InflateState>();
+    _state->buffer = std::make_unique<Bytef[]>(zlib::detail::CHUNK_SIZE);
+}
+
+size_t ZlibInputStream::read(void *data, size_t size) {
+    assert(_base);
+
+    if (_finished)
+        return 0;
+
+    z_stream &stream = _state->stream;
+    stream.next_out = static_cast<Bytef *>(data);
+    stream.avail_out = size;
+    while (stream.avail_out > 0) {
+        // Note that zlib might still have output pending even if all of the input was consumed, e.g. when a match
+        // copy was cut short by the end of the output buffer. So we always inflate first, and only refill the input
+        // when zlib reports that it can't make progress without it.
+        int res = inflate(&stream, Z_NO_FLUSH);
+        if (res == Z_STREAM_END) {
+            _finished = true;
+            break;
+        }
+
+        if (res == Z_BUF_ERROR && stream.avail_in == 0) {
+            stream.next_in = _state->buffer.get();
+            stream.avail_in = _base->read(_state->buffer.get(), zlib::detail::CHUNK_SIZE);
+            if (stream.avail_in == 0)
+                throw Exception("Failed to uncompress '{}': data is truncated", displayPath());
+            continue;
+        }
+
+        if (res != Z_OK)
+            throw Exception("Failed to uncompress '{}': {}", displayPath(), stream.msg ? stream.msg : "unknown error");
+    }
+
+    return size - stream.avail_out;
+}
+
+size_t ZlibInputStream::skip(size_t size) {
+    // There is no way to skip compressed data without decompressing it.
+    char buffer[4096];
+    size_t result = 0;
+    while (result < size) {
+        size_t chunk = std::min(size - result, sizeof(buffer));
+        size_t read = this->read(buffer, chunk);
+        result += read;
+        if (read < chunk)
+            break;
+    }
+    return result;
+}
+
+void ZlibInputStream::close() {
+    _base = nullptr;
+    _state.reset();
+    _finished = false;
+}
+
+std::string ZlibInputStream::displayPath() const {
+    return _base ? _base->displayPath() : std::string();
+}
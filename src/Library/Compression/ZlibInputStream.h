@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Utility/Streams/InputStream.h"
+
+namespace zlib::detail {
+struct InflateState;
+} // namespace zlib::detail
+
+/**
+ * Input stream that inflates zlib-compressed data read from another input stream.
+ *
+ * Compressed data is pulled from the base stream in fixed-size chunks, so memory usage doesn't depend on the size of
+ * the data being read.
+ */
+class ZlibInputStream : public InputStream {
+ public:
+    ZlibInputStream();
+    explicit ZlibInputStream(InputStream *base);
+    virtual ~ZlibInputStream();
+
+    /**
+     * @param base                      Stream to read compressed data from. Must outlive this stream, or `close` must
+     *                                  be called before it's destroyed.
+     */
+    void open(InputStream *base);
+
+    virtual size_t read(void *data, size_t size) override;
+    virtual size_t skip(size_t size) override;
+    virtual void close() override;
+    [[nodiscard]] virtual std::string displayPath() const override;
+
+ private:
+    InputStream *_base = nullptr;
+    std::unique_ptr<zlib::detail::InflateState> _state;
+    bool _finished = false;
+};
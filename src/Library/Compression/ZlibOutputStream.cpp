@@ -0,0 +1,85 @@
+#include "ZlibOutputStream.h"
+
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include "Utility/Exception.h"
+#include "Utility/ScopeGuard.h"
+
+#include "ZlibState.h"
+
+ZlibOutputStream::ZlibOutputStream() = default;
+
+ZlibOutputStream::ZlibOutputStream(OutputStream *base) {
+    open(base);
+}
+
+ZlibOutputStream::~ZlibOutputStream() {
+    closeInternal(false);
+}
+
+void ZlibOutputStream::open(OutputStream *base) {
+    assert(base);
+
+    close();
+
+    _base = base;
+    _state = std::make_unique<zlib::detail::DeflateState>();
+}
+
+void ZlibOutputStream::write(const void *data, size_t size) {
+    assert(_base); // Writing into a closed stream is UB.
+    if (!size)
+        return;
+
+    _state->stream.next_in = const_cast<Bytef *>(static_cast<const Bytef *>(data));
+    _state->stream.avail_in = size;
+    deflateInto(Z_NO_FLUSH);
+}
+
+void ZlibOutputStream::flush() {
+    assert(_base); // Flushing a closed stream is UB.
+
+    deflateInto(Z_SYNC_FLUSH);
+    _base->flush();
+}
+
+void ZlibOutputStream::close() {
+    closeInternal(true);
+}
+
+std::string ZlibOutputStream::displayPath() const {
+    return _base ? _base->displayPath() : std::string();
+}
+
+void ZlibOutputStream::deflateInto(int flush) {
+    z_stream &stream = _state->stream;
+    do {
+        stream.next_out = _state->buffer.get();
+        stream.avail_out = zlib::detail::CHUNK_SIZE;
+        if (deflate(&stream, flush) == Z_STREAM_ERROR)
+            throw Exception("Failed to compress data for '{}'", displayPath());
+        _base->write(_state->buffer.get(), zlib::detail::CHUNK_SIZE - stream.avail_out);
+    } while (stream.avail_out == 0);
+}
+
+void ZlibOutputStream::closeInternal(bool canThrow) {
+    if (!_base)
+        return;
+
+    MM_AT_SCOPE_EXIT({
+        _base = nullptr;
+        _state.reset();
+    });
+
+    if (canThrow) {
+        deflateInto(Z_FINISH);
+    } else {
+        try {
+            deflateInto(Z_FINISH);
+        } catch (...) {
+            // Can't throw from a destructor, compressed data is left unfinished.
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Utility/Streams/OutputStream.h"
+
+namespace zlib::detail {
+struct DeflateState;
+} // namespace zlib::detail
+
+/**
+ * Output stream that deflates the data written into it and writes the compressed result into another output stream.
+ *
+ * Note that the compressed stream is finalized only when `close` is called.
+ */
+class ZlibOutputStream : public OutputStream {
+ public:
+    ZlibOutputStream();
+    explicit ZlibOutputStream(OutputStream *base);
+    virtual ~ZlibOutputStream();
+
+    /**
+     * @param base                      Stream to write compressed data into. Must outlive this stream, or `close` must
+     *                                  be called before it's destroyed.
+     */
+    void open(OutputStream *base);
+
+    virtual void write(const void *data, size_t size) override;
+    virtual void flush() override;
+    virtual void close() override;
+    [[nodiscard]] virtual std::string displayPath() const override;
+
+    using OutputStream::write;
+
+ private:
+    void deflateInto(int flush);
+    void closeInternal(bool canThrow);
+
+ private:
+    OutputStream *_base = nullptr;
+    std::unique_ptr<zlib::detail::DeflateState> _state;
+};
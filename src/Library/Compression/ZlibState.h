@@ -0,0 +1,47 @@
+#pragma once
+
+#include <zlib.h>
+
+#include <memory>
+
+#include "Utility/Exception.h"
+
+// Private header, zlib is linked privately & shouldn't leak into the users of this library.
+
+namespace zlib::detail {
+
+inline constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+struct InflateState {
+    InflateState() {
+        if (inflateInit(&stream) != Z_OK)
+            throw Exception("Failed to initialize zlib inflate stream");
+    }
+
+    ~InflateState() {
+        inflateEnd(&stream);
+    }
+
+    void reset() {
+        inflateReset(&stream);
+    }
+
+    z_stream stream = {};
+    std::unique_ptr<Bytef[]> buffer; // Input buffer for streaming, allocated on demand.
+};
+
+struct DeflateState {
+    DeflateState() {
+        if (deflateInit(&stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+            throw Exception("Failed to initialize zlib deflate stream");
+    }
+
+    ~DeflateState() {
+        deflateEnd(&stream);
+    }
+
+    z_stream stream = {};
+    std::unique_ptr<Bytef[]> buffer = std::make_unique<Bytef[]>(CHUNK_SIZE); // Output buffer.
+};
+
+} // namespace zlib::detail
@@ -31,7 +31,7 @@ class AnyConfigEntry {
     void setValue(std::any value);
 
     void reset() {
-        _value = _defaultValue;
+        setValue(_defaultValue);
     }
 
     std::string defaultString() const;
@@ -77,6 +77,23 @@ class ConfigEntry : public AnyConfigEntry {
         });
     }
 
+    /**
+     * Binds this config entry to a plain variable. The variable is assigned the current value right away, and is then
+     * kept in sync through a change listener. This is meant for values that are read in tight loops, where going
+     * through the `std::any_cast` in `value()` on each read is too expensive.
+     *
+     * @param ctx                       Listener context, pass it to `removeListeners` to unbind.
+     * @param target                    Variable to keep in sync with this config entry. Must outlive the binding.
+     */
+    void bind(void *ctx, T *target) {
+        assert(target);
+
+        *target = value();
+        addListener(ctx, [this, target] {
+            *target = value();
+        });
+    }
+
  private:
     template<class TypedValidator>
     static Validator wrapValidator(TypedValidator validator) {
@@ -0,0 +1,45 @@
+#include <algorithm>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Config/Config.h"
+
+namespace {
+class TestConfig : public Config {
+ public:
+    struct Section : public ConfigSection {
+        explicit Section(TestConfig *config) : ConfigSection(config, "test") {}
+
+        ConfigEntry<int> value = {this, "value", 10, [](int value) { return std::clamp(value, 0, 100); }, ""};
+    };
+
+    Section section{this};
+};
+} // namespace
+
+UNIT_TEST(ConfigEntry, Bind) {
+    TestConfig config;
+    int bound = -1;
+    config.section.value.bind(&bound, &bound);
+    EXPECT_EQ(bound, 10); // Assigned right away.
+
+    config.section.value.setValue(20);
+    EXPECT_EQ(bound, 20);
+
+    config.section.value.setValue(1000);
+    EXPECT_EQ(bound, 100); // Validator is applied.
+
+    config.section.value.setString("30");
+    EXPECT_EQ(bound, 30);
+
+    config.section.value.reset();
+    EXPECT_EQ(bound, 10); // Reset goes through listeners too.
+
+    config.section.value.setValue(40);
+    config.reset();
+    EXPECT_EQ(bound, 10);
+
+    config.section.value.removeListeners(&bound);
+    config.section.value.setValue(50);
+    EXPECT_EQ(bound, 10); // Unbound.
+}
@@ -0,0 +1,198 @@
+#include "Fiber.h"
+
+#include <cassert>
+#include <exception>
+#include <utility>
+
+#if defined(_WINDOWS)
+#   define FIBER_USE_WINAPI
+#   include <windows.h>
+#elif (defined(__linux__) && !defined(__ANDROID__)) || defined(__FreeBSD__)
+#   define FIBER_USE_UCONTEXT
+#   include <sys/mman.h>
+#   include <ucontext.h>
+#   include <unistd.h>
+#   include <cstdint>
+#else
+#   define FIBER_USE_THREAD
+#   include <pthread.h>
+#   include <condition_variable>
+#   include <mutex>
+#endif
+
+#include "Utility/Exception.h"
+
+struct Fiber::Impl {
+    std::function<void()> body;
+    std::exception_ptr exception;
+    bool running = false;
+    bool finished = false;
+
+#if defined(FIBER_USE_WINAPI)
+    LPVOID callerFiber = nullptr;
+    LPVOID fiber = nullptr;
+#elif defined(FIBER_USE_UCONTEXT)
+    ucontext_t callerContext;
+    ucontext_t fiberContext;
+    void *stack = nullptr; // Mapping that starts with a guard page.
+    size_t stackMappingSize = 0;
+#else
+    pthread_t thread = {};
+    bool threadStarted = false;
+    size_t stackSize = 0;
+    std::mutex mutex;
+    std::condition_variable wakeEvent;
+    bool fiberTurn = false;
+#endif
+
+    void runBody() {
+        try {
+            body();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        finished = true;
+    }
+
+#if defined(FIBER_USE_WINAPI)
+    static void WINAPI entry(LPVOID param) {
+        Impl *impl = static_cast<Impl *>(param);
+        impl->runBody();
+
+        // Returning from a fiber procedure terminates the thread, so we just switch out & never come back.
+        SwitchToFiber(impl->callerFiber);
+        assert(false);
+    }
+#elif defined(FIBER_USE_UCONTEXT)
+    static void entry(unsigned lo, unsigned hi) {
+        // makecontext only passes int arguments, so the pointer is split in two.
+        uintptr_t ptr = (static_cast<uintptr_t>(hi) << 16 << 16) | lo;
+        reinterpret_cast<Impl *>(ptr)->runBody();
+        // Returning switches back into callerContext through uc_link.
+    }
+#else
+    static void *entry(void *param) {
+        Impl *impl = static_cast<Impl *>(param);
+        {
+            std::unique_lock lock(impl->mutex);
+            impl->wakeEvent.wait(lock, [&] { return impl->fiberTurn; });
+        }
+
+        impl->runBody();
+
+        std::lock_guard lock(impl->mutex);
+        impl->fiberTurn = false;
+        impl->wakeEvent.notify_all();
+        return nullptr;
+    }
+#endif
+};
+
+
+Fiber::Fiber(std::function<void()> body, size_t stackSize) : _impl(std::make_unique<Impl>()) {
+    assert(body);
+    _impl->body = std::move(body);
+
+#if defined(FIBER_USE_WINAPI)
+    _impl->fiber = CreateFiberEx(0, stackSize, FIBER_FLAG_FLOAT_SWITCH, &Impl::entry, _impl.get());
+    assert(_impl->fiber);
+#elif defined(FIBER_USE_UCONTEXT)
+    // Stack is mapped lazily by the OS, so only the pages that are actually used take up memory. The lowest page is
+    // a guard page, so that a stack overflow crashes right away instead of silently corrupting the heap.
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    stackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+    _impl->stackMappingSize = stackSize + pageSize;
+    _impl->stack = mmap(nullptr, _impl->stackMappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (_impl->stack == MAP_FAILED)
+        throw Exception("Failed to allocate a fiber stack of {} bytes", stackSize);
+    mprotect(_impl->stack, pageSize, PROT_NONE);
+
+    getcontext(&_impl->fiberContext);
+    _impl->fiberContext.uc_stack.ss_sp = static_cast<char *>(_impl->stack) + pageSize;
+    _impl->fiberContext.uc_stack.ss_size = stackSize;
+    _impl->fiberContext.uc_link = &_impl->callerContext;
+    uintptr_t ptr = reinterpret_cast<uintptr_t>(_impl.get());
+    makecontext(&_impl->fiberContext, reinterpret_cast<void (*)()>(&Impl::entry), 2,
+                static_cast<unsigned>(ptr), static_cast<unsigned>(ptr >> 16 >> 16));
+#else
+    _impl->stackSize = stackSize; // Thread is started on the first resume.
+#endif
+}
+
+Fiber::~Fiber() {
+    assert(!_impl->running);
+
+#if defined(FIBER_USE_WINAPI)
+    DeleteFiber(_impl->fiber);
+#elif defined(FIBER_USE_UCONTEXT)
+    munmap(_impl->stack, _impl->stackMappingSize);
+#else
+    if (_impl->threadStarted) {
+        if (_impl->finished) {
+            pthread_join(_impl->thread, nullptr);
+        } else {
+            pthread_detach(_impl->thread); // Destroying a suspended fiber is not supported, but let's at least not hang.
+        }
+    }
+#endif
+}
+
+void Fiber::resume() {
+    assert(!_impl->running && !_impl->finished);
+    _impl->running = true;
+
+#if defined(FIBER_USE_WINAPI)
+    if (!IsThreadAFiber())
+        ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+    _impl->callerFiber = GetCurrentFiber();
+    SwitchToFiber(_impl->fiber);
+#elif defined(FIBER_USE_UCONTEXT)
+    swapcontext(&_impl->callerContext, &_impl->fiberContext);
+#else
+    std::unique_lock lock(_impl->mutex);
+    if (!_impl->threadStarted) {
+        // std::thread doesn't let us set the stack size, and secondary threads get small stacks on some platforms
+        // (512Kb on macOS), so we go through pthreads directly.
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, _impl->stackSize);
+        int res = pthread_create(&_impl->thread, &attr, &Impl::entry, _impl.get());
+        pthread_attr_destroy(&attr);
+        if (res != 0) {
+            _impl->running = false;
+            throw Exception("Failed to start a fiber thread with a stack of {} bytes", _impl->stackSize);
+        }
+        _impl->threadStarted = true;
+    }
+    _impl->fiberTurn = true;
+    _impl->wakeEvent.notify_all();
+    _impl->wakeEvent.wait(lock, [&] { return !_impl->fiberTurn; });
+#endif
+
+    _impl->running = false;
+    if (_impl->exception)
+        std::rethrow_exception(std::exchange(_impl->exception, nullptr));
+}
+
+void Fiber::yield() {
+    assert(_impl->running);
+
+#if defined(FIBER_USE_WINAPI)
+    SwitchToFiber(_impl->callerFiber);
+#elif defined(FIBER_USE_UCONTEXT)
+    swapcontext(&_impl->fiberContext, &_impl->callerContext);
+#else
+    std::unique_lock lock(_impl->mutex);
+    _impl->fiberTurn = false;
+    _impl->wakeEvent.notify_all();
+    _impl->wakeEvent.wait(lock, [&] { return _impl->fiberTurn; });
+#endif
+}
+
+bool Fiber::isFinished() const {
+    return _impl->finished;
+}
+
+bool Fiber::isRunning() const {
+    return _impl->running;
+}
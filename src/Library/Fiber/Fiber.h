@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+/**
+ * Stackful coroutine that runs on the thread that resumes it.
+ *
+ * Execution switches into the fiber with `resume`, and back out of it with `yield`, so the fiber body & the calling
+ * code never run concurrently, and switching costs about as much as a function call. The fiber is finished once its
+ * body returns or throws; exceptions that escape the body are rethrown from `resume`.
+ *
+ * Usage example:
+ * ```
+ * Fiber fiber([&] {
+ *     step1();
+ *     fiber.yield();
+ *     step2();
+ * });
+ * fiber.resume(); // Runs step1.
+ * fiber.resume(); // Runs step2, fiber is finished after this call.
+ * ```
+ *
+ * Some notes:
+ * - Fibers use native context switching where it is available (Windows fibers, `ucontext` on Linux & FreeBSD). On
+ *   other platforms the body runs on a separate thread that is handed control in lockstep, which is functionally
+ *   equivalent, but slower, and gives the body its own set of `thread_local` variables. Requested stack size is
+ *   honored either way.
+ * - With `ucontext`, fiber stack has a guard page at the bottom, so stack overflows crash instead of corrupting
+ *   memory.
+ * - Don't yield from inside a `catch` block. The C++ runtime tracks the currently handled exceptions per thread, and
+ *   switching contexts in the middle of a handler corrupts this state. Save the exception with
+ *   `std::current_exception`, leave the handler, and then yield.
+ * - Destroying a fiber that has started, but hasn't finished, is not supported, as there is no way to unwind its
+ *   stack.
+ */
+class Fiber {
+ public:
+    static constexpr size_t DEFAULT_STACK_SIZE = 8 * 1024 * 1024;
+
+    /**
+     * Creates a new fiber. The body is not started until the first call to `resume`.
+     *
+     * @param body                      Fiber body.
+     * @param stackSize                 Stack size for the fiber, in bytes.
+     */
+    explicit Fiber(std::function<void()> body, size_t stackSize = DEFAULT_STACK_SIZE);
+    ~Fiber();
+
+    Fiber(const Fiber &) = delete;
+    Fiber &operator=(const Fiber &) = delete;
+
+    /**
+     * Switches into the fiber, and runs it until it either calls `yield` or finishes. Must not be called from inside
+     * the fiber, or after it has finished. If the fiber body throws, the exception is rethrown from this call.
+     */
+    void resume();
+
+    /**
+     * Switches back to the code that has called `resume`. Must be called from inside the fiber.
+     */
+    void yield();
+
+    /**
+     * @return                          Whether the fiber body has returned or thrown.
+     */
+    [[nodiscard]] bool isFinished() const;
+
+    /**
+     * @return                          Whether the fiber is currently running, i.e. whether the caller is inside
+     *                                  the fiber body.
+     */
+    [[nodiscard]] bool isRunning() const;
+
+ private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
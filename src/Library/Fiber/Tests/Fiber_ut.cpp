@@ -0,0 +1,62 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Fiber/Fiber.h"
+
+UNIT_TEST(Fiber, ResumeYield) {
+    std::vector<std::string> order;
+
+    Fiber fiber([&] {
+        order.push_back("fiber1");
+        fiber.yield();
+        order.push_back("fiber2");
+        fiber.yield();
+        order.push_back("fiber3");
+    });
+
+    EXPECT_FALSE(fiber.isFinished());
+    EXPECT_FALSE(fiber.isRunning());
+
+    while (!fiber.isFinished()) {
+        order.push_back("caller");
+        fiber.resume();
+    }
+
+    EXPECT_EQ(order, std::vector<std::string>({"caller", "fiber1", "caller", "fiber2", "caller", "fiber3"}));
+}
+
+UNIT_TEST(Fiber, IsRunning) {
+    bool runningInside = false;
+    Fiber fiber([&] { runningInside = fiber.isRunning(); });
+    fiber.resume();
+    EXPECT_TRUE(runningInside);
+    EXPECT_FALSE(fiber.isRunning());
+    EXPECT_TRUE(fiber.isFinished());
+}
+
+UNIT_TEST(Fiber, Exception) {
+    Fiber fiber([&] {
+        fiber.yield();
+        throw std::runtime_error("42");
+    });
+
+    fiber.resume();
+    EXPECT_THROW(fiber.resume(), std::runtime_error);
+    EXPECT_TRUE(fiber.isFinished());
+}
+
+UNIT_TEST(Fiber, DeepStack) {
+    // Make sure the fiber stack can take a decent amount of recursion.
+    auto recurse = [](auto &&self, int depth) -> int {
+        volatile char buffer[256] = {};
+        return depth == 0 ? buffer[0] : self(self, depth - 1) + buffer[depth % 256] + 1;
+    };
+
+    int result = 0;
+    Fiber fiber([&] { result = recurse(recurse, 10000); });
+    fiber.resume();
+    EXPECT_EQ(result, 10000);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "BBox.h"
+#include "Vec.h"
+
+/**
+ * Uniform grid spatial hash for point-like objects identified by dense integer ids.
+ *
+ * Objects are stored in the cell containing their XY position. The hash is meant to be updated incrementally: calling
+ * `update` for an object that didn't leave its cell is just a couple of float ops and a compare.
+ *
+ * Queries work in the XY plane only and return all ids whose position lies inside the query box, so the callers that
+ * need to account for object extents should expand the query box accordingly. Query results are sorted by id, so that
+ * the callers can iterate over them in exactly the same order as they would iterate over the full object list.
+ */
+class SpatialHash {
+ public:
+    explicit SpatialHash(float cellSize) : _cellSize(cellSize) {
+        assert(cellSize > 0);
+    }
+
+    void clear() {
+        _cells.clear();
+        _entries.clear();
+    }
+
+    /**
+     * @return                          Number of tracked ids. All ids in `[0, size())` are either in the hash, or
+     *                                  were explicitly removed.
+     */
+    [[nodiscard]] size_t size() const {
+        return _entries.size();
+    }
+
+    /**
+     * Resizes the id range tracked by this hash. Ids that fall out of the new range are removed, new ids are not
+     * added to the hash until `update` is called for them.
+     *
+     * @param size                      New size.
+     */
+    void resize(size_t size) {
+        for (size_t id = size; id < _entries.size(); id++)
+            remove(id);
+        _entries.resize(size);
+    }
+
+    /**
+     * @param id                        Object id. If it's outside the tracked range, the range is extended.
+     * @param pos                       New object position.
+     */
+    void update(int id, const Vec3f &pos) {
+        assert(id >= 0);
+
+        if (id >= _entries.size())
+            _entries.resize(id + 1);
+
+        Entry &entry = _entries[id];
+        int x = cellCoord(pos.x);
+        int y = cellCoord(pos.y);
+        if (entry.present && entry.x == x && entry.y == y)
+            return;
+
+        if (entry.present)
+            eraseFromCell(entry, id);
+
+        entry.present = true;
+        entry.x = x;
+        entry.y = y;
+        _cells[cellKey(x, y)].push_back(id);
+    }
+
+    void remove(int id) {
+        if (id >= _entries.size() || !_entries[id].present)
+            return;
+
+        eraseFromCell(_entries[id], id);
+        _entries[id].present = false;
+    }
+
+    /**
+     * @param bbox                      Query box, only XY part is used.
+     * @param[out] result               Sorted list of ids of all objects inside the query box, borders included.
+     *                                  Might also contain some objects that are slightly outside the query box.
+     *                                  Cleared by this function.
+     */
+    void query(const BBoxf &bbox, std::vector<int> *result) const {
+        result->clear();
+
+        int x1 = cellCoord(bbox.x1), x2 = cellCoord(bbox.x2);
+        int y1 = cellCoord(bbox.y1), y2 = cellCoord(bbox.y2);
+
+        int64_t cellCount = (static_cast<int64_t>(x2) - x1 + 1) * (static_cast<int64_t>(y2) - y1 + 1);
+        if (cellCount > static_cast<int64_t>(_entries.size())) {
+            // Query box is large compared to the number of objects, it's faster to just check all the entries.
+            for (size_t id = 0; id < _entries.size(); id++) {
+                const Entry &entry = _entries[id];
+                if (entry.present && entry.x >= x1 && entry.x <= x2 && entry.y >= y1 && entry.y <= y2)
+                    result->push_back(id);
+            }
+            return;
+        }
+
+        for (int y = y1; y <= y2; y++) {
+            for (int x = x1; x <= x2; x++) {
+                auto pos = _cells.find(cellKey(x, y));
+                if (pos != _cells.end())
+                    result->insert(result->end(), pos->second.begin(), pos->second.end());
+            }
+        }
+        std::ranges::sort(*result);
+    }
+
+ private:
+    struct Entry {
+        bool present = false;
+        int x = 0;
+        int y = 0;
+    };
+
+    [[nodiscard]] int cellCoord(float worldCoord) const {
+        // Clamp so that we don't overflow on int conversion for objects that have flown off to infinity.
+        constexpr float limit = 1 << 24;
+        return static_cast<int>(std::floor(std::clamp(worldCoord / _cellSize, -limit, limit)));
+    }
+
+    [[nodiscard]] static int64_t cellKey(int x, int y) {
+        return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+    }
+
+    void eraseFromCell(const Entry &entry, int id) {
+        auto pos = _cells.find(cellKey(entry.x, entry.y));
+        assert(pos != _cells.end());
+
+        std::vector<int> &ids = pos->second;
+        auto idPos = std::ranges::find(ids, id);
+        assert(idPos != ids.end());
+        *idPos = ids.back();
+        ids.pop_back();
+
+        if (ids.empty())
+            _cells.erase(pos);
+    }
+
+ private:
+    float _cellSize = 0;
+    std::unordered_map<int64_t, std::vector<int>> _cells;
+    std::vector<Entry> _entries;
+};
@@ -0,0 +1,58 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/SpatialHash.h"
+
+static std::vector<int> query(const SpatialHash &hash, float x1, float y1, float x2, float y2) {
+    BBoxf bbox;
+    bbox.x1 = x1;
+    bbox.y1 = y1;
+    bbox.x2 = x2;
+    bbox.y2 = y2;
+
+    std::vector<int> result;
+    hash.query(bbox, &result);
+    return result;
+}
+
+UNIT_TEST(SpatialHash, Query) {
+    SpatialHash hash(100);
+    hash.update(2, Vec3f(50, 50, 0));
+    hash.update(0, Vec3f(150, 50, 0));
+    hash.update(1, Vec3f(-50, -50, 0));
+
+    EXPECT_EQ(hash.size(), 3);
+    EXPECT_EQ(query(hash, 0, 0, 99, 99), std::vector<int>({2}));
+    EXPECT_EQ(query(hash, 0, 0, 199, 99), std::vector<int>({0, 2}));
+    EXPECT_EQ(query(hash, -1000, -1000, 1000, 1000), std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(query(hash, 1000, 1000, 2000, 2000), std::vector<int>());
+}
+
+UNIT_TEST(SpatialHash, Update) {
+    SpatialHash hash(100);
+    hash.update(0, Vec3f(50, 50, 0));
+    hash.update(1, Vec3f(60, 60, 0));
+    EXPECT_EQ(query(hash, 0, 0, 99, 99), std::vector<int>({0, 1}));
+
+    hash.update(0, Vec3f(250, 50, 0));
+    EXPECT_EQ(query(hash, 0, 0, 99, 99), std::vector<int>({1}));
+    EXPECT_EQ(query(hash, 200, 0, 299, 99), std::vector<int>({0}));
+
+    hash.remove(1);
+    EXPECT_EQ(query(hash, 0, 0, 99, 99), std::vector<int>());
+    EXPECT_EQ(hash.size(), 2);
+
+    hash.resize(0);
+    EXPECT_EQ(query(hash, -1000, -1000, 1000, 1000), std::vector<int>());
+}
+
+UNIT_TEST(SpatialHash, Borders) {
+    SpatialHash hash(100);
+    hash.update(0, Vec3f(100, 100, 0));
+    hash.update(1, Vec3f(-0.5f, -0.5f, 0));
+
+    EXPECT_EQ(query(hash, 100, 100, 100, 100), std::vector<int>({0}));
+    EXPECT_EQ(query(hash, -0.5f, -0.5f, -0.5f, -0.5f), std::vector<int>({1}));
+    EXPECT_EQ(query(hash, -1e30f, -1e30f, 1e30f, 1e30f), std::vector<int>({0, 1}));
+}
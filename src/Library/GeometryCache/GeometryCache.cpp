@@ -0,0 +1,128 @@
+#include "GeometryCache.h"
+
+#include <cassert>
+#include <algorithm>
+#include <ranges>
+
+// Dirty ranges that are closer than this many vertices are uploaded in one go. Uploading a few extra clean vertices
+// is cheaper than issuing another buffer update.
+static constexpr int DIRTY_MERGE_GAP = 64;
+
+void GeometryCache::clear() {
+    _faces.clear();
+    _batches = {};
+    _spareSlots.clear();
+    _stats = {};
+}
+
+void GeometryCache::beginFrame() {
+    for (Batch &batch : _batches)
+        batch.indices.clear();
+    _stats = {};
+}
+
+bool GeometryCache::needsUpdate(int faceId, int batch, const GeometryFaceState &state) const {
+    assert(faceId >= 0);
+
+    if (faceId >= _faces.size())
+        return true;
+
+    const Face &face = _faces[faceId];
+    return !face.valid || face.batch != batch || face.state != state;
+}
+
+void GeometryCache::update(int faceId, int batch, const GeometryFaceState &state,
+                           std::span<const GeometryVertex> vertices) {
+    assert(faceId >= 0);
+    assert(batch >= 0 && batch < MAX_BATCHES);
+    assert(vertices.size() % 3 == 0);
+
+    if (faceId >= _faces.size())
+        _faces.resize(faceId + 1);
+
+    Face &face = _faces[faceId];
+    int count = vertices.size();
+    if (face.batch != batch || face.slot.count != count) {
+        if (face.batch != -1)
+            _spareSlots[spareKey(faceId, face.batch)] = face.slot;
+        face.batch = batch;
+        face.slot = allocate(faceId, batch, count);
+    }
+
+    Batch &target = _batches[batch];
+    std::ranges::copy(vertices, target.vertices.begin() + face.slot.offset);
+    target.dirty.push_back(face.slot);
+
+    face.state = state;
+    face.valid = true;
+    _stats.facesRebuilt++;
+}
+
+void GeometryCache::invalidate(int faceId) {
+    if (faceId >= 0 && faceId < _faces.size())
+        _faces[faceId].valid = false;
+}
+
+void GeometryCache::draw(int faceId) {
+    assert(faceId >= 0 && faceId < _faces.size() && _faces[faceId].valid);
+
+    const Face &face = _faces[faceId];
+    std::vector<uint32_t> &indices = _batches[face.batch].indices;
+    for (int i = 0; i < face.slot.count; i++)
+        indices.push_back(face.slot.offset + i);
+}
+
+void GeometryCache::flush(GeometryUploader *uploader) {
+    for (int i = 0; i < MAX_BATCHES; i++) {
+        Batch &batch = _batches[i];
+
+        int size = batch.vertices.size();
+        if (size > batch.capacity) {
+            // Leave some headroom for faces that switch batches.
+            batch.capacity = size + size / 2;
+            uploader->reserveVertices(i, batch.capacity);
+            batch.dirty.clear();
+            batch.dirty.push_back(Slot(0, size));
+        }
+
+        if (!batch.dirty.empty()) {
+            auto upload = [&](Slot range) {
+                uploader->uploadVertices(i, range.offset, std::span(batch.vertices).subspan(range.offset, range.count));
+                _stats.vertexBytesUploaded += range.count * sizeof(GeometryVertex);
+            };
+
+            std::ranges::sort(batch.dirty, std::less(), &Slot::offset);
+
+            Slot range = batch.dirty[0];
+            for (const Slot &next : batch.dirty | std::views::drop(1)) {
+                if (next.offset <= range.offset + range.count + DIRTY_MERGE_GAP) {
+                    range.count = std::max(range.count, next.offset + next.count - range.offset);
+                } else {
+                    upload(range);
+                    range = next;
+                }
+            }
+            upload(range);
+            batch.dirty.clear();
+        }
+
+        if (!batch.indices.empty()) {
+            uploader->uploadIndices(i, batch.indices);
+            _stats.indexBytesUploaded += batch.indices.size() * sizeof(uint32_t);
+        }
+    }
+}
+
+GeometryCache::Slot GeometryCache::allocate(int faceId, int batch, int count) {
+    auto pos = _spareSlots.find(spareKey(faceId, batch));
+    if (pos != _spareSlots.end() && pos->second.count == count) {
+        Slot result = pos->second;
+        _spareSlots.erase(pos);
+        return result;
+    }
+
+    std::vector<GeometryVertex> &vertices = _batches[batch].vertices;
+    Slot result(vertices.size(), count);
+    vertices.resize(vertices.size() + count);
+    return result;
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "GeometryCacheStats.h"
+
+/**
+ * Vertex layout used for outdoor building & indoor face batches, this is what gets uploaded to the GPU.
+ */
+struct GeometryVertex {
+    float x;
+    float y;
+    float z;
+    float u;
+    float v;
+    float texunit;
+    float texturelayer;
+    float normx;
+    float normy;
+    float normz;
+    float attribs;
+    float sector;
+};
+
+/**
+ * Everything about a face that's baked into its cached vertices and that can change while the map is loaded without
+ * the face geometry changing. If any of these change, cached vertices for the face need to be rebuilt.
+ */
+struct GeometryFaceState {
+    int layer = 0;
+    int attributes = 0;
+    int deltaU = 0;
+    int deltaV = 0;
+
+    friend bool operator==(const GeometryFaceState &l, const GeometryFaceState &r) = default;
+};
+
+/**
+ * Receiver for the data that `GeometryCache::flush` pushes out. `OpenGLRenderer` implements this on top of vertex
+ * & index buffers.
+ */
+class GeometryUploader {
+ public:
+    virtual ~GeometryUploader() = default;
+
+    /**
+     * Reallocates vertex storage for a batch. Old contents don't need to be preserved, `uploadVertices` for the whole
+     * batch always follows.
+     *
+     * @param batch                     Batch index.
+     * @param capacity                  New capacity, in vertices.
+     */
+    virtual void reserveVertices(int batch, int capacity) = 0;
+
+    /**
+     * @param batch                     Batch index.
+     * @param offset                    Index of the first vertex to overwrite.
+     * @param vertices                  New vertex data.
+     */
+    virtual void uploadVertices(int batch, int offset, std::span<const GeometryVertex> vertices) = 0;
+
+    /**
+     * @param batch                     Batch index.
+     * @param indices                   Vertex indices of the triangles to draw this frame.
+     */
+    virtual void uploadIndices(int batch, std::span<const uint32_t> indices) = 0;
+};
+
+/**
+ * CPU-side cache of map face geometry, split into per-texture-unit batches.
+ *
+ * Vertices for each face are built once and stored at a fixed place in their batch, so after the initial upload only
+ * the ranges that were actually rewritten (moving doors, animated textures, scrolling sky floors) need to be sent to
+ * the GPU. Visibility is handled separately: faces that should be drawn this frame are queued with `draw`, and only
+ * their vertex indices are streamed each frame.
+ *
+ * Typical frame looks like this:
+ * ```
+ * cache.beginFrame();
+ * for (face : visibleFaces) {
+ *     if (cache.needsUpdate(id, unit, state))
+ *         cache.update(id, unit, state, buildVertices(face));
+ *     cache.draw(id);
+ * }
+ * cache.flush(&uploader);
+ * ```
+ */
+class GeometryCache {
+ public:
+    static constexpr int MAX_BATCHES = 16;
+
+    /**
+     * Drops all cached geometry. Should be called when the map is unloaded.
+     */
+    void clear();
+
+    /**
+     * Starts a new frame, clearing draw lists and per-frame counters.
+     */
+    void beginFrame();
+
+    /**
+     * @param faceId                    Face id, ids are expected to be dense.
+     * @param batch                     Batch the face should be in.
+     * @param state                     Current face state.
+     * @return                          Whether cached vertices for the face are missing or out of date.
+     */
+    [[nodiscard]] bool needsUpdate(int faceId, int batch, const GeometryFaceState &state) const;
+
+    /**
+     * Stores new vertices for a face. If the face stays in the same batch, then its vertices are overwritten in place,
+     * otherwise the old slot is put aside to be reused if the face ever comes back.
+     *
+     * @param faceId                    Face id.
+     * @param batch                     Batch to put the face into.
+     * @param state                     Face state the vertices were built from.
+     * @param vertices                  Face vertices, three per triangle.
+     */
+    void update(int faceId, int batch, const GeometryFaceState &state, std::span<const GeometryVertex> vertices);
+
+    /**
+     * Marks cached vertices for a face as out of date. Unknown face ids are ignored.
+     *
+     * @param faceId                    Face id.
+     */
+    void invalidate(int faceId);
+
+    /**
+     * Queues a face for drawing this frame. Face must be up to date.
+     *
+     * @param faceId                    Face id.
+     */
+    void draw(int faceId);
+
+    /**
+     * Pushes dirty vertex ranges and this frame's draw lists to the provided uploader.
+     *
+     * @param uploader                  Uploader to use.
+     */
+    void flush(GeometryUploader *uploader);
+
+    [[nodiscard]] std::span<const GeometryVertex> vertices(int batch) const {
+        return _batches[batch].vertices;
+    }
+
+    [[nodiscard]] std::span<const uint32_t> drawList(int batch) const {
+        return _batches[batch].indices;
+    }
+
+    [[nodiscard]] const GeometryCacheStats &frameStats() const {
+        return _stats;
+    }
+
+ private:
+    struct Slot {
+        int offset = 0;
+        int count = 0;
+    };
+
+    struct Face {
+        int batch = -1;
+        Slot slot;
+        GeometryFaceState state;
+        bool valid = false;
+    };
+
+    struct Batch {
+        std::vector<GeometryVertex> vertices;
+        std::vector<uint32_t> indices;
+        std::vector<Slot> dirty; // Not sorted, can overlap.
+        int capacity = 0; // Uploaded capacity, in vertices.
+    };
+
+    Slot allocate(int faceId, int batch, int count);
+
+    [[nodiscard]] static int64_t spareKey(int faceId, int batch) {
+        return static_cast<int64_t>(faceId) * MAX_BATCHES + batch;
+    }
+
+ private:
+    std::vector<Face> _faces;
+    std::array<Batch, MAX_BATCHES> _batches;
+    std::unordered_map<int64_t, Slot> _spareSlots; // Slots left behind by faces that moved to other batches.
+    GeometryCacheStats _stats;
+};
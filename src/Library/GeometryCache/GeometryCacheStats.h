@@ -0,0 +1,10 @@
+#pragma once
+
+/**
+ * Upload counters for a single frame.
+ */
+struct GeometryCacheStats {
+    int facesRebuilt = 0;
+    int vertexBytesUploaded = 0;
+    int indexBytesUploaded = 0;
+};
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/GeometryCache/GeometryCache.h"
+
+namespace {
+class RecordingUploader : public GeometryUploader {
+ public:
+    virtual void reserveVertices(int batch, int capacity) override {
+        buffers[batch].resize(capacity);
+        reserves++;
+    }
+
+    virtual void uploadVertices(int batch, int offset, std::span<const GeometryVertex> vertices) override {
+        std::ranges::copy(vertices, buffers[batch].begin() + offset);
+        uploadedVertices += vertices.size();
+    }
+
+    virtual void uploadIndices(int batch, std::span<const uint32_t> indices) override {
+        drawnVertices[batch].clear();
+        for (uint32_t index : indices)
+            drawnVertices[batch].push_back(buffers[batch][index]);
+    }
+
+    std::vector<GeometryVertex> buffers[GeometryCache::MAX_BATCHES];
+    std::vector<GeometryVertex> drawnVertices[GeometryCache::MAX_BATCHES];
+    int reserves = 0;
+    int uploadedVertices = 0;
+};
+} // namespace
+
+static std::vector<GeometryVertex> makeFace(float x, int triangles = 1) {
+    std::vector<GeometryVertex> result(3 * triangles);
+    for (GeometryVertex &vertex : result)
+        vertex.x = x;
+    return result;
+}
+
+UNIT_TEST(GeometryCache, UploadOnce) {
+    // Faces that didn't change shouldn't be uploaded again, only draw lists should be streamed.
+    GeometryCache cache;
+    RecordingUploader uploader;
+
+    cache.beginFrame();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(cache.needsUpdate(i, i % 2, {}));
+        cache.update(i, i % 2, {}, makeFace(i));
+    }
+    cache.draw(10);
+    cache.flush(&uploader);
+    EXPECT_EQ(uploader.uploadedVertices, 300);
+    EXPECT_EQ(cache.frameStats().facesRebuilt, 100);
+    EXPECT_EQ(cache.frameStats().vertexBytesUploaded, 300 * sizeof(GeometryVertex));
+    ASSERT_EQ(uploader.drawnVertices[0].size(), 3);
+    EXPECT_EQ(uploader.drawnVertices[0][0].x, 10);
+
+    cache.beginFrame();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_FALSE(cache.needsUpdate(i, i % 2, {}));
+        cache.draw(i);
+    }
+    cache.flush(&uploader);
+    EXPECT_EQ(uploader.uploadedVertices, 300);
+    EXPECT_EQ(cache.frameStats().facesRebuilt, 0);
+    EXPECT_EQ(cache.frameStats().vertexBytesUploaded, 0);
+    EXPECT_EQ(cache.frameStats().indexBytesUploaded, 300 * sizeof(uint32_t));
+    EXPECT_EQ(uploader.drawnVertices[0].size(), 150);
+    EXPECT_EQ(uploader.drawnVertices[1].size(), 150);
+}
+
+UNIT_TEST(GeometryCache, DirtyRanges) {
+    // Only the rewritten ranges should be uploaded.
+    GeometryCache cache;
+    RecordingUploader uploader;
+
+    cache.beginFrame();
+    for (int i = 0; i < 1000; i++)
+        cache.update(i, 0, {}, makeFace(i));
+    cache.flush(&uploader);
+
+    cache.beginFrame();
+    cache.invalidate(5);
+    cache.invalidate(900);
+    EXPECT_TRUE(cache.needsUpdate(5, 0, {}));
+    EXPECT_TRUE(cache.needsUpdate(900, 0, {}));
+    EXPECT_TRUE(cache.needsUpdate(7, 0, {.layer = 1}));
+    EXPECT_FALSE(cache.needsUpdate(6, 0, {}));
+
+    cache.update(5, 0, {}, makeFace(-5));
+    cache.update(900, 0, {}, makeFace(-900));
+    cache.update(7, 0, {.layer = 1}, makeFace(-7));
+    cache.draw(5);
+    cache.draw(900);
+    cache.flush(&uploader);
+
+    // Faces 5 & 7 are close enough to be merged into a single range.
+    EXPECT_EQ(cache.frameStats().facesRebuilt, 3);
+    EXPECT_EQ(cache.frameStats().vertexBytesUploaded, (9 + 3) * sizeof(GeometryVertex));
+    ASSERT_EQ(uploader.drawnVertices[0].size(), 6);
+    EXPECT_EQ(uploader.drawnVertices[0][0].x, -5);
+    EXPECT_EQ(uploader.drawnVertices[0][3].x, -900);
+    EXPECT_EQ(uploader.buffers[0][21].x, -7);
+}
+
+UNIT_TEST(GeometryCache, BatchSwitch) {
+    // Faces that switch batches should get their old slots back when they return.
+    GeometryCache cache;
+    RecordingUploader uploader;
+
+    cache.beginFrame();
+    cache.update(0, 0, {}, makeFace(0, 2));
+    cache.update(1, 0, {}, makeFace(1, 2));
+    cache.flush(&uploader);
+    EXPECT_EQ(cache.vertices(0).size(), 12);
+
+    cache.beginFrame();
+    EXPECT_TRUE(cache.needsUpdate(0, 1, {}));
+    cache.update(0, 1, {}, makeFace(10, 2));
+    cache.draw(0);
+    cache.flush(&uploader);
+    EXPECT_EQ(cache.vertices(1).size(), 6);
+    EXPECT_EQ(cache.drawList(0).size(), 0);
+    ASSERT_EQ(uploader.drawnVertices[1].size(), 6);
+    EXPECT_EQ(uploader.drawnVertices[1][0].x, 10);
+
+    cache.beginFrame();
+    cache.update(0, 0, {}, makeFace(20, 2));
+    cache.update(0, 1, {}, makeFace(30, 2));
+    cache.flush(&uploader);
+    EXPECT_EQ(cache.vertices(0).size(), 12);
+    EXPECT_EQ(cache.vertices(1).size(), 6);
+    EXPECT_EQ(cache.vertices(0)[0].x, 20);
+    EXPECT_EQ(cache.vertices(1)[0].x, 30);
+}
+
+UNIT_TEST(GeometryCache, Growth) {
+    // Growing past the uploaded capacity should reallocate & reupload the whole batch.
+    GeometryCache cache;
+    RecordingUploader uploader;
+
+    cache.beginFrame();
+    cache.update(0, 3, {}, makeFace(0));
+    cache.flush(&uploader);
+    EXPECT_EQ(uploader.reserves, 1);
+
+    cache.beginFrame();
+    for (int i = 1; i < 10; i++)
+        cache.update(i, 3, {}, makeFace(i));
+    cache.draw(0);
+    cache.draw(9);
+    cache.flush(&uploader);
+    EXPECT_EQ(uploader.reserves, 2);
+    EXPECT_EQ(cache.frameStats().vertexBytesUploaded, 30 * sizeof(GeometryVertex));
+    ASSERT_EQ(uploader.drawnVertices[3].size(), 6);
+    EXPECT_EQ(uploader.drawnVertices[3][0].x, 0);
+    EXPECT_EQ(uploader.drawnVertices[3][3].x, 9);
+
+    cache.clear();
+    EXPECT_TRUE(cache.needsUpdate(0, 3, {}));
+    EXPECT_TRUE(cache.vertices(3).empty());
+}
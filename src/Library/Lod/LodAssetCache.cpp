@@ -0,0 +1,47 @@
+#include "LodAssetCache.h"
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+LodAssetCache::LodAssetCache(size_t byteBudget) : _byteBudget(byteBudget) {}
+
+LodAssetCache::~LodAssetCache() = default;
+
+void LodAssetCache::clear() {
+    _nodeByKey.clear();
+    _nodes.clear();
+    _byteSize = 0;
+}
+
+size_t LodAssetCache::KeyHash::operator()(const Key &key) const {
+    size_t result = std::hash<const void *>()(key.data);
+    result ^= std::hash<size_t>()(key.size) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    result ^= key.type.hash_code() + 0x9e3779b9 + (result << 6) + (result >> 2);
+    return result;
+}
+
+std::shared_ptr<const void> LodAssetCache::find(const Key &key) {
+    auto pos = _nodeByKey.find(key);
+    if (pos == _nodeByKey.end())
+        return nullptr;
+
+    _nodes.splice(_nodes.begin(), _nodes, pos->second);
+    return pos->second->asset;
+}
+
+void LodAssetCache::insert(const Key &key, std::shared_ptr<const void> asset, size_t byteSize) {
+    if (byteSize > _byteBudget)
+        return; // Won't fit anyway, and we don't want to evict everything else.
+
+    _nodes.push_front(Node{key, std::move(asset), byteSize});
+    _nodeByKey.emplace(key, _nodes.begin());
+    _byteSize += byteSize;
+
+    while (_byteSize > _byteBudget) {
+        const Node &node = _nodes.back();
+        _byteSize -= node.byteSize;
+        _nodeByKey.erase(node.key);
+        _nodes.pop_back();
+    }
+}
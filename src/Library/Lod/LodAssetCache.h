@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Byte-budgeted LRU cache of assets decoded from LOD entries.
+ *
+ * Assets are keyed by the memory of the LOD entry they were decoded from, and by asset type. This means that entry
+ * blobs must point into memory that outlives the cache, e.g. into a memory-mapped LOD that's never closed. Temporary
+ * blobs, like the ones returned from `lod::decodeCompressed`, must not be used as keys.
+ *
+ * Cached assets are handed out as `shared_ptr`s, so evicting an asset from the cache doesn't invalidate it for the
+ * users that are still holding on to it.
+ */
+class LodAssetCache {
+ public:
+    /**
+     * @param byteBudget                Total size of all cached assets, in bytes. Least recently used assets are
+     *                                  evicted once the budget is exceeded.
+     */
+    explicit LodAssetCache(size_t byteBudget);
+    ~LodAssetCache();
+
+    /**
+     * @param entry                     LOD entry to get a decoded asset for.
+     * @param decoder                   Decoder, `T(const Blob &)`. Called only if the asset is not in the cache.
+     * @param sizer                     Function returning the size of a decoded asset in bytes, `size_t(const T &)`.
+     * @return                          Decoded asset.
+     */
+    template<class T, class Decoder, class Sizer>
+    [[nodiscard]] std::shared_ptr<const T> decode(const Blob &entry, Decoder &&decoder, Sizer &&sizer) {
+        Key key{entry.data(), entry.size(), typeid(T)};
+        if (std::shared_ptr<const void> cached = find(key))
+            return std::static_pointer_cast<const T>(cached);
+
+        std::shared_ptr<const T> result = std::make_shared<const T>(decoder(entry));
+        insert(key, result, sizer(*result));
+        return result;
+    }
+
+    void clear();
+
+    [[nodiscard]] size_t byteSize() const {
+        return _byteSize;
+    }
+
+ private:
+    struct Key {
+        const void *data;
+        size_t size;
+        std::type_index type;
+
+        friend bool operator==(const Key &l, const Key &r) = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    struct Node {
+        Key key;
+        std::shared_ptr<const void> asset;
+        size_t byteSize;
+    };
+
+    [[nodiscard]] std::shared_ptr<const void> find(const Key &key);
+    void insert(const Key &key, std::shared_ptr<const void> asset, size_t byteSize);
+
+ private:
+    size_t _byteBudget = 0;
+    size_t _byteSize = 0;
+    std::list<Node> _nodes; // Most recently used first.
+    std::unordered_map<Key, std::list<Node>::iterator, KeyHash> _nodeByKey;
+};
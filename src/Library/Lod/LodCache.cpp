@@ -0,0 +1,147 @@
+#include "LodCache.h"
+
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "Utility/String/Ascii.h"
+#include "Utility/Exception.h"
+
+namespace {
+
+struct CacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t sourceChecksum;
+    uint32_t cacheSize;
+    uint32_t entryCount;
+};
+static_assert(sizeof(CacheHeader) == 20);
+
+struct CacheEntry {
+    uint32_t nameOffset;
+    uint32_t nameSize;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+};
+static_assert(sizeof(CacheEntry) == 16);
+
+constexpr size_t DATA_ALIGNMENT = 8;
+
+size_t alignUp(size_t value) {
+    return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+}
+
+} // namespace
+
+LodCacheWriter::LodCacheWriter() = default;
+LodCacheWriter::~LodCacheWriter() = default;
+
+void LodCacheWriter::write(std::string_view filename, Blob data) {
+    _files.insert_or_assign(ascii::toLower(filename), std::move(data));
+}
+
+Blob LodCacheWriter::finish(uint32_t sourceChecksum) {
+    std::string result(sizeof(CacheHeader) + sizeof(CacheEntry) * _files.size(), '\0');
+
+    size_t index = 0;
+    for (const auto &[name, data] : _files) {
+        CacheEntry entry;
+        entry.nameOffset = result.size();
+        entry.nameSize = name.size();
+        result += name;
+
+        result.resize(alignUp(result.size()), '\0');
+        entry.dataOffset = result.size();
+        entry.dataSize = data.size();
+        result += data.string_view();
+
+        memcpy(result.data() + sizeof(CacheHeader) + sizeof(CacheEntry) * index++, &entry, sizeof(entry));
+    }
+
+    if (result.size() > UINT32_MAX)
+        throw Exception("LOD cache is too large: {} bytes", result.size());
+
+    CacheHeader header;
+    memcpy(header.magic, lod_cache::MAGIC.data(), sizeof(header.magic));
+    header.version = lod_cache::VERSION;
+    header.sourceChecksum = sourceChecksum;
+    header.cacheSize = result.size();
+    header.entryCount = _files.size();
+    memcpy(result.data(), &header, sizeof(header));
+
+    _files.clear();
+    return Blob::fromString(std::move(result));
+}
+
+LodCacheReader::LodCacheReader() = default;
+LodCacheReader::~LodCacheReader() = default;
+
+void LodCacheReader::open(Blob blob, uint32_t sourceChecksum) {
+    close();
+
+    CacheHeader header;
+    if (blob.size() < sizeof(header))
+        throw Exception("File '{}' is not a valid LOD cache: expected file size at least {} bytes, got {} bytes",
+                        blob.displayPath(), sizeof(header), blob.size());
+    memcpy(&header, blob.data(), sizeof(header));
+
+    if (std::string_view(header.magic, sizeof(header.magic)) != lod_cache::MAGIC)
+        throw Exception("File '{}' is not a valid LOD cache: invalid magic", blob.displayPath());
+    if (header.version != lod_cache::VERSION)
+        throw Exception("LOD cache '{}' has version {}, expected {}",
+                        blob.displayPath(), header.version, lod_cache::VERSION);
+    if (header.sourceChecksum != sourceChecksum)
+        throw Exception("LOD cache '{}' is stale: source checksum is {:08x}, expected {:08x}",
+                        blob.displayPath(), header.sourceChecksum, sourceChecksum);
+    if (header.cacheSize != blob.size())
+        throw Exception("LOD cache '{}' is corrupted: expected {} bytes, got {} bytes",
+                        blob.displayPath(), header.cacheSize, blob.size());
+
+    size_t directorySize = sizeof(CacheEntry) * header.entryCount;
+    if (blob.size() - sizeof(CacheHeader) < directorySize)
+        throw Exception("File '{}' is not a valid LOD cache: directory is truncated", blob.displayPath());
+
+    const char *data = static_cast<const char *>(blob.data());
+    std::unordered_map<std::string, CacheRegion> files;
+    for (size_t i = 0; i < header.entryCount; i++) {
+        CacheEntry entry;
+        memcpy(&entry, data + sizeof(CacheHeader) + sizeof(CacheEntry) * i, sizeof(entry));
+
+        // Offsets & sizes are 32-bit, so these can't overflow in 64-bit arithmetic.
+        if (static_cast<size_t>(entry.nameOffset) + entry.nameSize > blob.size() ||
+            static_cast<size_t>(entry.dataOffset) + entry.dataSize > blob.size())
+            throw Exception("File '{}' is not a valid LOD cache: entry #{} is out of bounds", blob.displayPath(), i);
+
+        files.emplace(std::string(data + entry.nameOffset, entry.nameSize),
+                      CacheRegion{entry.dataOffset, entry.dataSize});
+    }
+
+    // All good, can update `this`.
+    _cache = std::move(blob);
+    _files = std::move(files);
+}
+
+void LodCacheReader::close() {
+    // Double-closing is OK.
+    _cache = Blob();
+    _files = {};
+}
+
+bool LodCacheReader::exists(std::string_view filename) const {
+    assert(isOpen());
+
+    return _files.contains(ascii::toLower(filename));
+}
+
+Blob LodCacheReader::read(std::string_view filename) const {
+    assert(isOpen());
+
+    const auto pos = _files.find(ascii::toLower(filename));
+    if (pos == _files.cend())
+        throw Exception("Entry '{}' doesn't exist in LOD cache '{}'", filename, _cache.displayPath());
+
+    return _cache.subBlob(pos->second.offset, pos->second.size)
+        .withDisplayPath(fmt::format("{}/{}", _cache.displayPath(), filename));
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Utility/Memory/Blob.h"
+
+namespace lod_cache {
+inline constexpr std::string_view MAGIC = "OELC";
+inline constexpr uint32_t VERSION = 2;
+} // namespace lod_cache
+
+/**
+ * Writer for LOD caches - flat files holding decoded LOD entries, so that they don't need to be decoded again on the
+ * next run.
+ *
+ * Cache layout is as follows, all integers are little-endian `uint32_t`s:
+ * - Header: magic, version, source checksum, cache size, entry count.
+ * - Directory: entry count records of name offset, name size, data offset, data size. Offsets are relative to the
+ *   start of the file.
+ * - Payload: entry names and data. Data is 8-byte aligned, so that the cache can be memory-mapped and used in place.
+ *
+ * Source checksum is whatever the user passes in, and is used to invalidate the cache when the source LOD changes.
+ * The payload itself is not checksummed, as that would mean touching every page of the cache on open. Truncated
+ * caches are caught by the cache size check, and broken directories by bounds checks.
+ */
+class LodCacheWriter {
+ public:
+    LodCacheWriter();
+    ~LodCacheWriter();
+
+    /**
+     * @param filename                  Name of the LOD entry.
+     * @param data                      Decoded entry data.
+     */
+    void write(std::string_view filename, Blob data);
+
+    /**
+     * Serializes all entries written so far into a cache blob, and resets this writer.
+     *
+     * @param sourceChecksum            Checksum of the source LOD.
+     * @return                          Serialized cache.
+     */
+    [[nodiscard]] Blob finish(uint32_t sourceChecksum);
+
+ private:
+    std::map<std::string, Blob> _files; // Sorted so that the output is deterministic.
+};
+
+/**
+ * Reader for LOD caches, see `LodCacheWriter` for the format description.
+ *
+ * All blobs returned from `read` point directly into the cache blob, so nothing is copied if the cache is
+ * memory-mapped.
+ */
+class LodCacheReader {
+ public:
+    LodCacheReader();
+    ~LodCacheReader();
+
+    /**
+     * @param blob                      Cache data.
+     * @param sourceChecksum            Checksum of the source LOD.
+     * @throw Exception                 If the cache is malformed or truncated, or if it was built from a different
+     *                                  LOD.
+     */
+    void open(Blob blob, uint32_t sourceChecksum);
+
+    void close();
+
+    [[nodiscard]] bool isOpen() const {
+        return !!_cache;
+    }
+
+    /**
+     * @param filename                  Name of the LOD entry.
+     * @return                          Whether the entry is in the cache. The check is case-insensitive.
+     */
+    [[nodiscard]] bool exists(std::string_view filename) const;
+
+    /**
+     * @param filename                  Name of the LOD entry.
+     * @return                          Decoded entry data.
+     * @throw Exception                 If the entry is not in the cache.
+     */
+    [[nodiscard]] Blob read(std::string_view filename) const;
+
+ private:
+    struct CacheRegion {
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+ private:
+    Blob _cache;
+    std::unordered_map<std::string, CacheRegion> _files;
+};
@@ -0,0 +1,68 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Lod/LodAssetCache.h"
+
+UNIT_TEST(LodAssetCache, DecodesOnce) {
+    std::string data = "0123456789";
+    Blob entry = Blob::view(data);
+    LodAssetCache cache(1000);
+
+    int decodeCount = 0;
+    auto decoder = [&] (const Blob &blob) {
+        decodeCount++;
+        return std::string(blob.string_view());
+    };
+    auto sizer = [] (const std::string &value) { return value.size(); };
+
+    std::shared_ptr<const std::string> first = cache.decode<std::string>(entry, decoder, sizer);
+    std::shared_ptr<const std::string> second = cache.decode<std::string>(entry, decoder, sizer);
+    EXPECT_EQ(*first, data);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(decodeCount, 1);
+    EXPECT_EQ(cache.byteSize(), 10);
+
+    // Same entry decoded as a different type is a different asset.
+    std::shared_ptr<const size_t> size = cache.decode<size_t>(entry, [] (const Blob &blob) { return blob.size(); },
+                                                              [] (size_t) { return sizeof(size_t); });
+    EXPECT_EQ(*size, 10);
+    EXPECT_EQ(cache.byteSize(), 10 + sizeof(size_t));
+}
+
+UNIT_TEST(LodAssetCache, EvictsLeastRecentlyUsed) {
+    std::string data = "0123456789";
+    LodAssetCache cache(5);
+
+    int decodeCount = 0;
+    auto decoder = [&] (const Blob &blob) {
+        decodeCount++;
+        return std::string(blob.string_view());
+    };
+    auto sizer = [] (const std::string &value) { return value.size(); };
+
+    // Entries are distinguished by memory, so subblobs of the same blob are different entries.
+    Blob a = Blob::view(data).subBlob(0, 2);
+    Blob b = Blob::view(data).subBlob(2, 2);
+    Blob c = Blob::view(data).subBlob(4, 2);
+
+    (void) cache.decode<std::string>(a, decoder, sizer);
+    (void) cache.decode<std::string>(b, decoder, sizer);
+    (void) cache.decode<std::string>(a, decoder, sizer); // Touch a, so that b is evicted next.
+    EXPECT_EQ(decodeCount, 2);
+
+    std::shared_ptr<const std::string> cValue = cache.decode<std::string>(c, decoder, sizer);
+    EXPECT_EQ(decodeCount, 3);
+    EXPECT_EQ(cache.byteSize(), 4);
+
+    (void) cache.decode<std::string>(a, decoder, sizer);
+    EXPECT_EQ(decodeCount, 3); // Still cached.
+    (void) cache.decode<std::string>(b, decoder, sizer);
+    EXPECT_EQ(decodeCount, 4); // Was evicted.
+
+    // Assets that are too large are not cached, but are still returned.
+    Blob large = Blob::view(data);
+    EXPECT_EQ(*cache.decode<std::string>(large, decoder, sizer), data);
+    EXPECT_EQ(cache.byteSize(), 4);
+    EXPECT_EQ(*cValue, "45"); // Evicted assets are still alive.
+}
@@ -0,0 +1,49 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Lod/LodCache.h"
+
+UNIT_TEST(LodCache, RoundTrip) {
+    LodCacheWriter writer;
+    writer.write("MapStats.txt", Blob::fromString("map stats"));
+    writer.write("dsft.bin", Blob::fromString(std::string(1000, '\x42')));
+    writer.write("empty.txt", Blob());
+    Blob cache = writer.finish(0x12345678);
+
+    LodCacheReader reader;
+    reader.open(Blob::share(cache), 0x12345678);
+    EXPECT_TRUE(reader.isOpen());
+    EXPECT_TRUE(reader.exists("mapstats.txt"));
+    EXPECT_FALSE(reader.exists("monsters.txt"));
+    EXPECT_EQ(reader.read("MAPSTATS.TXT").string_view(), "map stats");
+    EXPECT_EQ(reader.read("dsft.bin").string_view(), std::string(1000, '\x42'));
+    EXPECT_EQ(reader.read("empty.txt").size(), 0);
+    EXPECT_ANY_THROW((void) reader.read("monsters.txt"));
+
+    // Data is aligned & points into the cache blob.
+    Blob data = reader.read("dsft.bin");
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data.data()) % 8, reinterpret_cast<uintptr_t>(cache.data()) % 8);
+    EXPECT_GE(data.data(), cache.data());
+    EXPECT_LT(data.data(), static_cast<const char *>(cache.data()) + cache.size());
+}
+
+UNIT_TEST(LodCache, Invalid) {
+    LodCacheWriter writer;
+    writer.write("a.txt", Blob::fromString("aaaa"));
+    Blob cache = writer.finish(1);
+
+    LodCacheReader reader;
+    EXPECT_ANY_THROW(reader.open(Blob::share(cache), 2)); // Stale.
+    EXPECT_ANY_THROW(reader.open(cache.subBlob(0, cache.size() - 1), 1)); // Truncated.
+    EXPECT_ANY_THROW(reader.open(Blob::fromString("OELC"), 1)); // Too short.
+
+    std::string corrupted(cache.string_view());
+    corrupted[20 + 12 + 3] = '\xFF'; // High byte of the first entry's data size.
+    EXPECT_ANY_THROW(reader.open(Blob::fromString(corrupted), 1)); // Out of bounds entry.
+    EXPECT_ANY_THROW(reader.open(Blob::fromString(std::string(cache.string_view()) + "x"), 1)); // Wrong size.
+    EXPECT_FALSE(reader.isOpen());
+
+    reader.open(Blob::share(cache), 1);
+    EXPECT_EQ(reader.read("a.txt").string_view(), "aaaa");
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+#include "Library/Random/SequentialRandomEngine.h"
+#include "Library/Random/WeightedSampler.h"
+
+UNIT_TEST(WeightedSampler, SampleByWeight) {
+    WeightedSampler<char> sampler;
+    sampler.add('a', 2);
+    sampler.add('b', 0);
+    sampler.add('c', 3);
+    sampler.add('d', 1);
+    sampler.finalize();
+
+    EXPECT_FALSE(sampler.empty());
+    EXPECT_EQ(sampler.totalWeight(), 6);
+    EXPECT_EQ(sampler.sampleByWeight(1), 'a');
+    EXPECT_EQ(sampler.sampleByWeight(2), 'a');
+    EXPECT_EQ(sampler.sampleByWeight(3), 'c');
+    EXPECT_EQ(sampler.sampleByWeight(5), 'c');
+    EXPECT_EQ(sampler.sampleByWeight(6), 'd');
+}
+
+UNIT_TEST(WeightedSampler, Empty) {
+    WeightedSampler<int> sampler;
+    sampler.add(1, 0);
+    sampler.finalize();
+
+    EXPECT_TRUE(sampler.empty());
+    EXPECT_EQ(sampler.totalWeight(), 0);
+}
+
+UNIT_TEST(WeightedSampler, MatchesLinearScan) {
+    MersenneTwisterRandomEngine weightRng;
+
+    for (int size : {1, 2, 3, 7, 64, 500}) {
+        std::vector<int> weights;
+        for (int i = 0; i < size; i++)
+            weights.push_back(weightRng.random(4) == 0 ? 0 : weightRng.random(i % 5 == 0 ? 1000 : 10) + 1);
+        weights[0] = std::max(weights[0], 1);
+
+        WeightedSampler<int> sampler;
+        for (int i = 0; i < size; i++)
+            sampler.add(i, weights[i]);
+        sampler.finalize();
+
+        for (int weight = 1; weight <= sampler.totalWeight(); weight++) {
+            int index = 0;
+            for (int sum = weights[0]; sum < weight; sum += weights[++index]) {}
+            EXPECT_EQ(sampler.sampleByWeight(weight), index);
+        }
+
+        // Sampling should consume exactly one random number.
+        SequentialRandomEngine rng0, rng1;
+        for (int i = 0; i < 10; i++) {
+            EXPECT_EQ(sampler.sample(&rng0), sampler.sampleByWeight(rng1.random(sampler.totalWeight()) + 1));
+            EXPECT_EQ(rng0.peek(1000), rng1.peek(1000));
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "RandomEngine.h"
+
+/**
+ * Weighted random sampler over a fixed set of values.
+ *
+ * Sampling is equivalent to the classic "roll a number in `[1, totalWeight]` and walk the cumulative weights until
+ * the roll is reached" loop, and thus consumes exactly one `RandomEngine::random(totalWeight)` call, and returns the
+ * same values for the same random state. This is important as the random streams are part of the game state, and
+ * changing how they are consumed would break save compatibility & trace playback.
+ *
+ * Unlike the linear walk, lookup uses a guide table that maps evenly-sized weight buckets onto the first value that
+ * can be found in each bucket, which makes it constant time on average.
+ *
+ * Usage is to `add` all values, then call `finalize`, and then sample as many times as needed.
+ */
+template<class T>
+class WeightedSampler {
+ public:
+    /**
+     * @param value                     Value to add.
+     * @param weight                    Weight of the value. Values with zero weight are skipped, as they can never
+     *                                  be sampled.
+     */
+    void add(const T &value, int weight) {
+        assert(weight >= 0);
+        assert(_guide.empty()); // Can't add after finalize.
+
+        if (weight == 0)
+            return;
+
+        _totalWeight += weight;
+        _values.push_back(value);
+        _cumulativeWeights.push_back(_totalWeight);
+    }
+
+    /**
+     * Builds the guide table. Must be called after all values were added, and before sampling.
+     */
+    void finalize() {
+        size_t size = _values.size();
+        _guide.assign(size, 0);
+
+        size_t index = 0;
+        for (size_t bucket = 0; bucket < size; bucket++) {
+            // Smallest weight that maps into this bucket, see bucketForWeight.
+            int64_t minWeight = (static_cast<int64_t>(bucket) * _totalWeight + size - 1) / size + 1;
+            while (index + 1 < size && _cumulativeWeights[index] < minWeight)
+                index++;
+            _guide[bucket] = index;
+        }
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _values.empty();
+    }
+
+    [[nodiscard]] int totalWeight() const {
+        return _totalWeight;
+    }
+
+    /**
+     * @param weight                    Weight in `[1, totalWeight()]`.
+     * @return                          First value at which the cumulative weight reaches `weight`.
+     */
+    [[nodiscard]] const T &sampleByWeight(int weight) const {
+        assert(!_guide.empty() && weight >= 1 && weight <= _totalWeight);
+
+        size_t index = _guide[bucketForWeight(weight)];
+        while (_cumulativeWeights[index] < weight)
+            index++;
+        return _values[index];
+    }
+
+    /**
+     * @param rng                       Random engine to use. Exactly one `random(totalWeight())` call is made.
+     * @return                          Randomly sampled value.
+     */
+    [[nodiscard]] const T &sample(RandomEngine *rng) const {
+        return sampleByWeight(rng->random(_totalWeight) + 1);
+    }
+
+ private:
+    [[nodiscard]] size_t bucketForWeight(int weight) const {
+        return static_cast<int64_t>(weight - 1) * _values.size() / _totalWeight;
+    }
+
+ private:
+    int _totalWeight = 0;
+    std::vector<T> _values;
+    std::vector<int> _cumulativeWeights;
+    std::vector<size_t> _guide;
+};
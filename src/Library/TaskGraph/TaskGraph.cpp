@@ -0,0 +1,122 @@
+#include "TaskGraph.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TaskGraph::TaskGraph() = default;
+TaskGraph::~TaskGraph() = default;
+
+TaskGraph::TaskId TaskGraph::addTask(std::string name, std::function<void()> task,
+                                     std::initializer_list<TaskId> dependencies) {
+    return addTaskInternal(std::move(name), std::move(task), false, dependencies);
+}
+
+TaskGraph::TaskId TaskGraph::addMainThreadTask(std::string name, std::function<void()> task,
+                                               std::initializer_list<TaskId> dependencies) {
+    return addTaskInternal(std::move(name), std::move(task), true, dependencies);
+}
+
+TaskGraph::TaskId TaskGraph::addTaskInternal(std::string name, std::function<void()> task, bool mainThread,
+                                             std::initializer_list<TaskId> dependencies) {
+    TaskId result = _tasks.size();
+    for (TaskId dependency : dependencies) {
+        assert(dependency < result); // Can only depend on tasks that were already added.
+        _tasks[dependency].dependents.push_back(result);
+    }
+
+    Task &newTask = _tasks.emplace_back();
+    newTask.name = std::move(name);
+    newTask.function = std::move(task);
+    newTask.mainThread = mainThread;
+    newTask.dependencyCount = dependencies.size();
+    return result;
+}
+
+void TaskGraph::run(size_t threadCount) {
+    _timings.clear();
+    Clock::time_point start = Clock::now();
+
+    if (threadCount == 0) {
+        for (const Task &task : _tasks) {
+            Clock::time_point taskStart = Clock::now();
+            task.function();
+            _timings.push_back({task.name, taskStart - start, Clock::now() - taskStart});
+        }
+        return;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<TaskId> readyMain;
+    std::deque<TaskId> readyAny;
+    std::vector<size_t> dependencyCounts;
+    size_t remaining = _tasks.size();
+    std::exception_ptr exception;
+
+    auto enqueue = [&](TaskId id) {
+        (_tasks[id].mainThread ? readyMain : readyAny).push_back(id);
+    };
+
+    for (TaskId id = 0; id < _tasks.size(); id++) {
+        dependencyCounts.push_back(_tasks[id].dependencyCount);
+        if (dependencyCounts.back() == 0)
+            enqueue(id);
+    }
+
+    auto loop = [&](bool mainThread) {
+        std::unique_lock lock(mutex);
+        while (true) {
+            condition.wait(lock, [&] {
+                return remaining == 0 || exception || !readyAny.empty() || (mainThread && !readyMain.empty());
+            });
+            if (remaining == 0 || exception)
+                return;
+
+            // Main thread prioritizes main thread tasks as nobody else can run them.
+            std::deque<TaskId> &queue = mainThread && !readyMain.empty() ? readyMain : readyAny;
+            TaskId id = queue.front();
+            queue.pop_front();
+            const Task &task = _tasks[id];
+
+            lock.unlock();
+            Clock::time_point taskStart = Clock::now();
+            std::exception_ptr taskException;
+            try {
+                task.function();
+            } catch (...) {
+                taskException = std::current_exception();
+            }
+            Clock::time_point taskEnd = Clock::now();
+            lock.lock();
+
+            _timings.push_back({task.name, taskStart - start, taskEnd - taskStart});
+            if (taskException) {
+                if (!exception)
+                    exception = taskException;
+            } else {
+                for (TaskId dependent : task.dependents)
+                    if (--dependencyCounts[dependent] == 0)
+                        enqueue(dependent);
+                remaining--;
+            }
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threadCount; i++)
+        workers.emplace_back(loop, false);
+    loop(true);
+    for (std::thread &worker : workers)
+        worker.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+/**
+ * A set of tasks with declared dependencies that can be run in parallel on a pool of worker threads.
+ *
+ * Dependencies can only reference tasks that were added before, so there can be no cycles, and the order in which
+ * the tasks were added is always a valid sequential execution order.
+ *
+ * Usage example:
+ * ```
+ * TaskGraph graph;
+ * TaskGraph::TaskId localizationTask = graph.addTask("localization", [] { loadLocalization(); });
+ * graph.addTask("items", [] { loadItems(); }, {localizationTask});
+ * graph.addMainThreadTask("ui", [] { createUi(); });
+ * graph.run(std::thread::hardware_concurrency());
+ * ```
+ */
+class TaskGraph {
+ public:
+    using TaskId = size_t;
+    using Clock = std::chrono::steady_clock;
+
+    struct TaskTiming {
+        std::string name;
+        Clock::duration start; // Relative to the start of `run`.
+        Clock::duration duration;
+    };
+
+    TaskGraph();
+    ~TaskGraph();
+
+    /**
+     * @param name                      Task name, used for reporting.
+     * @param task                      Task function.
+     * @param dependencies              Tasks that must finish before this task is started.
+     * @return                          Id of the added task.
+     */
+    TaskId addTask(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies = {});
+
+    /**
+     * Same as `addTask`, but the task is guaranteed to be run on the thread that called `run`. Use this for tasks
+     * that touch thread-affine state, e.g. the graphics context. Main thread tasks never run concurrently with each
+     * other, but they do run concurrently with the tasks added with `addTask`.
+     */
+    TaskId addMainThreadTask(std::string name, std::function<void()> task,
+                             std::initializer_list<TaskId> dependencies = {});
+
+    /**
+     * Runs all tasks and waits for them to finish.
+     *
+     * If a task throws, no new tasks are started, and the exception is rethrown once all the running tasks finish.
+     *
+     * @param threadCount               Number of worker threads to use, in addition to the calling thread. Passing
+     *                                  zero runs all tasks on the calling thread, in the order they were added.
+     */
+    void run(size_t threadCount);
+
+    /**
+     * @return                          Timings for the tasks that were run in the last call to `run`, in the order
+     *                                  they were finished.
+     */
+    [[nodiscard]] const std::vector<TaskTiming> &timings() const {
+        return _timings;
+    }
+
+ private:
+    struct Task {
+        std::string name;
+        std::function<void()> function;
+        bool mainThread = false;
+        size_t dependencyCount = 0;
+        std::vector<TaskId> dependents;
+    };
+
+    TaskId addTaskInternal(std::string name, std::function<void()> task, bool mainThread,
+                           std::initializer_list<TaskId> dependencies);
+
+ private:
+    std::vector<Task> _tasks;
+    std::vector<TaskTiming> _timings;
+};
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/TaskGraph/TaskGraph.h"
+
+UNIT_TEST(TaskGraph, Dependencies) {
+    for (size_t threadCount : {0, 1, 4}) {
+        std::mutex mutex;
+        std::vector<std::string> order;
+        auto record = [&](std::string name) {
+            return [&, name] {
+                std::lock_guard lock(mutex);
+                order.push_back(name);
+            };
+        };
+
+        TaskGraph graph;
+        TaskGraph::TaskId a = graph.addTask("a", record("a"));
+        TaskGraph::TaskId b = graph.addTask("b", record("b"), {a});
+        TaskGraph::TaskId c = graph.addMainThreadTask("c", record("c"), {a});
+        graph.addTask("d", record("d"), {b, c});
+        graph.run(threadCount);
+
+        EXPECT_EQ(order.size(), 4);
+        EXPECT_EQ(order.front(), "a");
+        EXPECT_EQ(order.back(), "d");
+        EXPECT_EQ(graph.timings().size(), 4);
+        if (threadCount == 0) {
+            EXPECT_EQ(order, std::vector<std::string>({"a", "b", "c", "d"}));
+        }
+    }
+}
+
+UNIT_TEST(TaskGraph, MainThread) {
+    std::thread::id mainThreadId = std::this_thread::get_id();
+    std::atomic<int> mainThreadCount = 0;
+
+    TaskGraph graph;
+    for (int i = 0; i < 20; i++) {
+        graph.addMainThreadTask("main", [&] {
+            if (std::this_thread::get_id() == mainThreadId)
+                mainThreadCount++;
+        });
+        graph.addTask("any", [] {});
+    }
+    graph.run(4);
+
+    EXPECT_EQ(mainThreadCount, 20);
+}
+
+UNIT_TEST(TaskGraph, Exception) {
+    std::atomic<bool> dependentRan = false;
+
+    TaskGraph graph;
+    TaskGraph::TaskId a = graph.addTask("a", [] { throw std::runtime_error("a"); });
+    graph.addTask("b", [&] { dependentRan = true; }, {a});
+
+    EXPECT_THROW(graph.run(2), std::runtime_error);
+    EXPECT_FALSE(dependentRan);
+}
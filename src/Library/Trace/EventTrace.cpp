@@ -11,6 +11,8 @@
 #include "Io/Key.h" // TODO(captainurist): doesn't belong here
 
 #include "PaintEvent.h"
+#include "EventTraceBinary.h"
+#include "EventTraceDispatch.h"
 
 MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(Pointi, (
     (x, "x"),
@@ -108,40 +110,6 @@ MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(PaintEvent, (
     (randomState, "randomState")
 ))
 
-template<class Callable>
-inline void dispatchByEventType(PlatformEventType type, Callable &&callable) {
-    switch (type) {
-    case EVENT_KEY_PRESS:
-    case EVENT_KEY_RELEASE:
-        callable(static_cast<PlatformKeyEvent *>(nullptr));
-        break;
-    case EVENT_MOUSE_BUTTON_PRESS:
-    case EVENT_MOUSE_BUTTON_RELEASE:
-    case EVENT_MOUSE_MOVE:
-        callable(static_cast<PlatformMouseEvent *>(nullptr));
-        break;
-    case EVENT_MOUSE_WHEEL:
-        callable(static_cast<PlatformWheelEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_MOVE:
-        callable(static_cast<PlatformMoveEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_RESIZE:
-        callable(static_cast<PlatformResizeEvent *>(nullptr));
-        break;
-    case EVENT_WINDOW_ACTIVATE:
-    case EVENT_WINDOW_DEACTIVATE:
-    case EVENT_WINDOW_CLOSE_REQUEST:
-        callable(static_cast<PlatformWindowEvent *>(nullptr));
-        break;
-    case EVENT_PAINT:
-        callable(static_cast<PaintEvent *>(nullptr));
-        break;
-    default:
-        return; // No gamepad events.
-    }
-}
-
 static void to_json(Json &json, const std::unique_ptr<PlatformEvent> &value) {
     if (!value) {
         json = nullptr;
@@ -243,6 +211,29 @@ EventTrace EventTrace::fromJsonBlob(const Blob &blob, PlatformWindow *window) {
     return result;
 }
 
+Blob EventTrace::toBinaryBlob(const EventTrace &trace, bool compress) {
+    EventTraceWriter writer;
+    for (const std::unique_ptr<PlatformEvent> &event : trace.events)
+        writer.write(event.get());
+    return writer.finish(trace.header, compress);
+}
+
+EventTrace EventTrace::fromBinaryBlob(const Blob &blob, PlatformWindow *window) {
+    EventTraceReader reader(blob, window);
+
+    EventTrace result;
+    result.header = reader.header();
+    while (std::unique_ptr<PlatformEvent> event = reader.read())
+        result.events.push_back(std::move(event));
+    return result;
+}
+
+EventTrace EventTrace::fromBlob(const Blob &blob, PlatformWindow *window) {
+    if (EventTraceReader::isBinaryTrace(blob))
+        return fromBinaryBlob(blob, window);
+    return fromJsonBlob(blob, window);
+}
+
 bool EventTrace::isTraceable(const PlatformEvent *event) {
     bool result = false;
     dispatchByEventType(event->type, [&](auto) { result = true; }); // Callback not invoked => not supported.
@@ -56,6 +56,19 @@ struct EventTrace {
     static Blob toJsonBlob(const EventTrace &trace);
     static EventTrace fromJsonBlob(const Blob &blob, PlatformWindow *window);
 
+    /**
+     * @param trace                     Trace to serialize.
+     * @param compress                  Whether to zlib-compress the result.
+     * @return                          Trace serialized in binary format, see `EventTraceWriter`.
+     */
+    static Blob toBinaryBlob(const EventTrace &trace, bool compress);
+    static EventTrace fromBinaryBlob(const Blob &blob, PlatformWindow *window);
+
+    /**
+     * Deserializes a trace, detecting whether it's stored in JSON or in binary format.
+     */
+    static EventTrace fromBlob(const Blob &blob, PlatformWindow *window);
+
     static bool isTraceable(const PlatformEvent *event);
     static std::unique_ptr<PlatformEvent> cloneEvent(const PlatformEvent *event);
 
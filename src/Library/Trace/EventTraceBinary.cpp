@@ -0,0 +1,420 @@
+#include "EventTraceBinary.h"
+
+#include <cassert>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Library/Compression/Compression.h"
+#include "Library/Compression/ZlibInputStream.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Exception.h"
+
+#include "EventTraceDispatch.h"
+#include "PaintEvent.h"
+
+namespace {
+
+class BinaryWriter {
+ public:
+    explicit BinaryWriter(std::string *target) : _target(target) {}
+
+    void writeUInt(uint64_t value) {
+        while (value >= 0x80) {
+            _target->push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        _target->push_back(static_cast<char>(value));
+    }
+
+    void writeInt(int64_t value) {
+        writeUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)); // Zigzag.
+    }
+
+    void writeBool(bool value) {
+        _target->push_back(value ? 1 : 0);
+    }
+
+    void writeFixed32(int32_t value) {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (int i = 0; i < 4; i++)
+            _target->push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+    }
+
+    void writeString(std::string_view value) {
+        writeUInt(value.size());
+        _target->append(value);
+    }
+
+    void writeStrings(const std::vector<std::string> &values) {
+        writeUInt(values.size());
+        for (const std::string &value : values)
+            writeString(value);
+    }
+
+ private:
+    std::string *_target = nullptr;
+};
+
+} // namespace
+
+namespace trace_binary::detail {
+
+/**
+ * Buffered reader on top of an input stream. Data is pulled from the stream in small chunks, so for compressed traces
+ * only a chunk's worth of the payload is decompressed at a time.
+ *
+ * Counts & sizes read from the stream are checked against the number of bytes left in the payload before anything is
+ * allocated, so that a corrupted trace can't make us allocate gigabytes.
+ */
+class BinaryReader {
+ public:
+    BinaryReader(InputStream *stream, size_t size, std::string_view displayPath) :
+        _stream(stream), _buffer(std::make_unique<uint8_t[]>(BUFFER_SIZE)), _size(size), _displayPath(displayPath) {}
+
+    uint64_t readUInt() {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = readByte();
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return result;
+        }
+        throw Exception("Malformed varint in binary trace '{}'", _displayPath);
+    }
+
+    int64_t readInt() {
+        uint64_t value = readUInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    bool readBool() {
+        return readByte() != 0;
+    }
+
+    int32_t readFixed32() {
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; i++)
+            bits |= static_cast<uint32_t>(readByte()) << (i * 8);
+        return static_cast<int32_t>(bits);
+    }
+
+    /**
+     * Reads an element count and checks it against the remaining payload.
+     *
+     * @param minElementSize            Minimal number of bytes a single element takes in the payload.
+     * @return                          Element count.
+     * @throw Exception                 If the remaining payload is too short to hold that many elements.
+     */
+    size_t readCount(size_t minElementSize) {
+        uint64_t count = readUInt();
+        if (count > remaining() / minElementSize)
+            throw Exception("Invalid element count {} in binary trace '{}', only {} bytes left",
+                            count, _displayPath, remaining());
+        return count;
+    }
+
+    std::string readString() {
+        size_t size = readCount(1);
+        std::string result;
+        result.reserve(size);
+        while (result.size() < size) {
+            if (_bufferPos == _bufferSize)
+                refill();
+            size_t chunk = std::min<uint64_t>(size - result.size(), _bufferSize - _bufferPos);
+            result.append(reinterpret_cast<const char *>(_buffer.get() + _bufferPos), chunk);
+            _bufferPos += chunk;
+        }
+        return result;
+    }
+
+    std::vector<std::string> readStrings() {
+        std::vector<std::string> result(readCount(1)); // Each string takes at least one byte for its size.
+        for (std::string &value : result)
+            value = readString();
+        return result;
+    }
+
+    uint8_t readByte() {
+        if (_bufferPos == _bufferSize)
+            refill();
+        return _buffer[_bufferPos++];
+    }
+
+    /**
+     * @return                          Number of bytes consumed from the underlying stream so far.
+     */
+    [[nodiscard]] size_t position() const {
+        return _consumed - (_bufferSize - _bufferPos);
+    }
+
+    /**
+     * @return                          Number of payload bytes left to read.
+     */
+    [[nodiscard]] size_t remaining() const {
+        size_t position = this->position();
+        return position < _size ? _size - position : 0;
+    }
+
+ private:
+    void refill() {
+        _bufferSize = _stream->read(_buffer.get(), BUFFER_SIZE);
+        _bufferPos = 0;
+        _consumed += _bufferSize;
+        if (_bufferSize == 0)
+            throw Exception("Unexpected end of data in binary trace '{}'", _displayPath);
+    }
+
+ private:
+    static constexpr size_t BUFFER_SIZE = 4096;
+
+    InputStream *_stream = nullptr;
+    std::unique_ptr<uint8_t[]> _buffer;
+    size_t _bufferPos = 0;
+    size_t _bufferSize = 0;
+    size_t _consumed = 0;
+    size_t _size = 0;
+    std::string _displayPath;
+};
+
+} // namespace trace_binary::detail
+
+using trace_binary::detail::BinaryReader;
+
+namespace {
+
+/** Deflate can't compress data by more than ~1032:1. */
+constexpr uint64_t MAX_DEFLATE_RATIO = 1032;
+
+void writeGameState(BinaryWriter *writer, const EventTraceGameState &state) {
+    writer->writeString(state.locationName);
+    writer->writeInt(state.partyPosition.x);
+    writer->writeInt(state.partyPosition.y);
+    writer->writeInt(state.partyPosition.z);
+    writer->writeUInt(state.characters.size());
+    for (const EventTraceCharacterState &character : state.characters) {
+        for (int value : {character.hp, character.mp, character.might, character.intelligence, character.personality,
+                          character.endurance, character.accuracy, character.speed, character.luck})
+            writer->writeInt(value);
+        writer->writeStrings(character.equipment);
+        writer->writeStrings(character.backpack);
+    }
+}
+
+void readGameState(BinaryReader *reader, EventTraceGameState *state) {
+    state->locationName = reader->readString();
+    state->partyPosition.x = reader->readInt();
+    state->partyPosition.y = reader->readInt();
+    state->partyPosition.z = reader->readInt();
+    state->characters.resize(reader->readCount(11)); // 9 stats & 2 string list sizes.
+    for (EventTraceCharacterState &character : state->characters) {
+        for (int *value : {&character.hp, &character.mp, &character.might, &character.intelligence,
+                           &character.personality, &character.endurance, &character.accuracy, &character.speed,
+                           &character.luck})
+            *value = reader->readInt();
+        character.equipment = reader->readStrings();
+        character.backpack = reader->readStrings();
+    }
+}
+
+void writeHeader(BinaryWriter *writer, const EventTraceHeader &header) {
+    writer->writeInt(header.saveFileSize);
+    writer->writeUInt(header.config.entries().size());
+    for (const ConfigPatchEntry &entry : header.config.entries()) {
+        writer->writeString(entry.section);
+        writer->writeString(entry.key);
+        writer->writeString(entry.value);
+    }
+    writeGameState(writer, header.startState);
+    writeGameState(writer, header.endState);
+    writer->writeFixed32(header.afterLoadRandomState);
+}
+
+void readHeader(BinaryReader *reader, EventTraceHeader *header) {
+    header->saveFileSize = reader->readInt();
+    std::vector<ConfigPatchEntry> entries(reader->readCount(3)); // Section, key & value sizes.
+    for (ConfigPatchEntry &entry : entries) {
+        entry.section = reader->readString();
+        entry.key = reader->readString();
+        entry.value = reader->readString();
+    }
+    header->config = ConfigPatch::fromEntries(std::move(entries));
+    readGameState(reader, &header->startState);
+    readGameState(reader, &header->endState);
+    header->afterLoadRandomState = reader->readFixed32();
+}
+
+} // namespace
+
+EventTraceWriter::EventTraceWriter() = default;
+EventTraceWriter::~EventTraceWriter() = default;
+
+void EventTraceWriter::write(const PlatformEvent *event) {
+    assert(EventTrace::isTraceable(event));
+
+    BinaryWriter writer(&_events);
+    writer.writeUInt(std::to_underlying(event->type) + 1); // Zero is the end marker.
+
+    dispatchByEventType(event->type, [&]<class T>(T *) {
+        const T *typedEvent = static_cast<const T *>(event);
+        if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+            writer.writeUInt(std::to_underlying(typedEvent->key));
+            writer.writeUInt(static_cast<PlatformModifiers::underlying_type>(typedEvent->mods));
+            writer.writeBool(typedEvent->isAutoRepeat);
+        } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+            writer.writeUInt(std::to_underlying(typedEvent->button));
+            writer.writeUInt(static_cast<PlatformMouseButtons::underlying_type>(typedEvent->buttons));
+            writer.writeInt(typedEvent->pos.x - _lastMousePos.x);
+            writer.writeInt(typedEvent->pos.y - _lastMousePos.y);
+            writer.writeBool(typedEvent->isDoubleClick);
+            _lastMousePos = typedEvent->pos;
+        } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+            writer.writeInt(typedEvent->angleDelta.x);
+            writer.writeInt(typedEvent->angleDelta.y);
+        } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+            writer.writeInt(typedEvent->pos.x);
+            writer.writeInt(typedEvent->pos.y);
+        } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+            writer.writeInt(typedEvent->size.w);
+            writer.writeInt(typedEvent->size.h);
+        } else if constexpr (std::is_same_v<T, PaintEvent>) {
+            writer.writeInt(typedEvent->tickCount - _lastTickCount);
+            writer.writeFixed32(typedEvent->randomState);
+            _lastTickCount = typedEvent->tickCount;
+        } else {
+            static_assert(std::is_same_v<T, PlatformWindowEvent>); // No payload.
+        }
+    });
+}
+
+Blob EventTraceWriter::finish(const EventTraceHeader &header, bool compress) {
+    std::string payload;
+    BinaryWriter payloadWriter(&payload);
+    writeHeader(&payloadWriter, header);
+    payload += _events;
+    payload.push_back(0); // End marker.
+
+    _events.clear();
+    _lastTickCount = 0;
+    _lastMousePos = Pointi();
+
+    std::string result(trace_binary::MAGIC);
+    BinaryWriter writer(&result);
+    writer.writeFixed32(trace_binary::VERSION);
+    result.push_back(compress ? trace_binary::FLAG_COMPRESSED : 0);
+
+    if (compress) {
+        writer.writeUInt(payload.size());
+        Blob compressed = zlib::compress(Blob::view(payload));
+        result.append(compressed.string_view());
+    } else {
+        result += payload;
+    }
+
+    return Blob::fromString(std::move(result));
+}
+
+EventTraceReader::EventTraceReader(const Blob &blob, PlatformWindow *window) :
+    _displayPath(blob.displayPath()),
+    _window(window) {
+    if (!isBinaryTrace(blob))
+        throw Exception("'{}' is not a binary trace", _displayPath);
+
+    Blob preamble = blob.subBlob(trace_binary::MAGIC.size());
+    BlobInputStream preambleStream(preamble);
+    BinaryReader preambleReader(&preambleStream, preamble.size(), _displayPath);
+    uint32_t version = preambleReader.readFixed32();
+    if (version != trace_binary::VERSION)
+        throw Exception("Unsupported binary trace version {} in '{}', expected {}",
+                        version, _displayPath, trace_binary::VERSION);
+
+    uint8_t flags = preambleReader.readByte();
+    _compressed = flags & trace_binary::FLAG_COMPRESSED;
+    uint64_t uncompressedPayloadSize = _compressed ? preambleReader.readUInt() : 0;
+
+    // Payload is decoded on demand, and if it's compressed, it's also inflated on demand.
+    Blob payload = preamble.subBlob(preambleReader.position());
+    uint64_t payloadSize = payload.size();
+    if (_compressed) {
+        // Uncompressed size is only used to bound the counts in the payload, so it's enough to check that it's
+        // achievable with deflate.
+        if (uncompressedPayloadSize / MAX_DEFLATE_RATIO > payload.size())
+            throw Exception("Invalid uncompressed payload size {} in binary trace '{}'", uncompressedPayloadSize,
+                            _displayPath);
+        payloadSize = uncompressedPayloadSize;
+    }
+
+    _blobStream = std::make_unique<BlobInputStream>(std::move(payload));
+    InputStream *payloadStream = _blobStream.get();
+    if (_compressed) {
+        _zlibStream = std::make_unique<ZlibInputStream>(_blobStream.get());
+        payloadStream = _zlibStream.get();
+    }
+    _reader = std::make_unique<BinaryReader>(payloadStream, payloadSize, _displayPath);
+
+    readHeader(_reader.get(), &_header);
+}
+
+EventTraceReader::~EventTraceReader() = default;
+
+bool EventTraceReader::isBinaryTrace(const Blob &blob) {
+    return blob.string_view().starts_with(trace_binary::MAGIC);
+}
+
+std::unique_ptr<PlatformEvent> EventTraceReader::read() {
+    if (_finished)
+        return nullptr;
+
+    BinaryReader &reader = *_reader;
+    uint64_t type = reader.readUInt();
+    if (type == 0) {
+        _finished = true;
+        return nullptr;
+    }
+
+    std::unique_ptr<PlatformEvent> result;
+    dispatchByEventType(static_cast<PlatformEventType>(type - 1), [&]<class T>(T *) {
+        std::unique_ptr<T> event = std::make_unique<T>();
+        event->type = static_cast<PlatformEventType>(type - 1);
+        if constexpr (std::is_base_of_v<PlatformWindowEvent, T>)
+            event->window = _window;
+
+        if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+            event->key = static_cast<PlatformKey>(reader.readUInt());
+            event->mods = PlatformModifiers(static_cast<PlatformModifiers::underlying_type>(reader.readUInt()));
+            event->isAutoRepeat = reader.readBool();
+        } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+            event->button = static_cast<PlatformMouseButton>(reader.readUInt());
+            event->buttons =
+                PlatformMouseButtons(static_cast<PlatformMouseButtons::underlying_type>(reader.readUInt()));
+            event->pos.x = _lastMousePos.x + reader.readInt();
+            event->pos.y = _lastMousePos.y + reader.readInt();
+            event->isDoubleClick = reader.readBool();
+            _lastMousePos = event->pos;
+        } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+            event->angleDelta.x = reader.readInt();
+            event->angleDelta.y = reader.readInt();
+        } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+            event->pos.x = reader.readInt();
+            event->pos.y = reader.readInt();
+        } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+            event->size.w = reader.readInt();
+            event->size.h = reader.readInt();
+        } else if constexpr (std::is_same_v<T, PaintEvent>) {
+            event->tickCount = _lastTickCount + reader.readInt();
+            event->randomState = reader.readFixed32();
+            _lastTickCount = event->tickCount;
+        }
+
+        result = std::move(event);
+    });
+
+    if (!result)
+        throw Exception("Unsupported event type {} in binary trace '{}'", type - 1, _displayPath);
+
+    return result;
+}
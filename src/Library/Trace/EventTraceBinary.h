@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Library/Geometry/Point.h"
+
+#include "Utility/Memory/Blob.h"
+
+#include "EventTrace.h"
+
+class InputStream;
+class PlatformEvent;
+class PlatformWindow;
+
+namespace trace_binary::detail {
+class BinaryReader;
+} // namespace trace_binary::detail
+
+/**
+ * Compact binary trace format.
+ *
+ * Layout is a fixed preamble (`MAGIC`, format version as a little-endian `uint32_t`, flags byte), followed by the
+ * payload. If `FLAG_COMPRESSED` is set, then the payload is zlib-compressed, and is prefixed with its uncompressed size
+ * as a varint.
+ *
+ * Payload starts with the trace header, followed by a sequence of event records terminated by a zero byte. All
+ * integers are stored as LEB128 varints, signed integers are zigzag-encoded first. Paint event tick counts and mouse
+ * positions are delta-encoded relative to the previous paint / mouse event, so a typical trace needs just a few bytes
+ * per event.
+ *
+ * The format stores exactly the same data as the JSON one, so converting between the two is lossless. Binary traces
+ * are detected by `MAGIC`, but are expected to be stored with `FILE_EXTENSION`, next to a save with the same name.
+ */
+namespace trace_binary {
+inline constexpr std::string_view FILE_EXTENSION = ".oetb";
+inline constexpr std::string_view MAGIC = "OETB";
+inline constexpr uint32_t VERSION = 1;
+inline constexpr uint8_t FLAG_COMPRESSED = 0x01;
+} // namespace trace_binary
+
+/**
+ * Writer for the binary trace format. Events are appended one by one, and the header is written on `finish`.
+ */
+class EventTraceWriter {
+ public:
+    EventTraceWriter();
+    ~EventTraceWriter();
+
+    /**
+     * @param event                     Event to write, must be traceable, see `EventTrace::isTraceable`.
+     */
+    void write(const PlatformEvent *event);
+
+    /**
+     * @param header                    Trace header.
+     * @param compress                  Whether the payload should be zlib-compressed.
+     * @return                          Serialized trace. The writer is reset and can be reused after this call.
+     */
+    [[nodiscard]] Blob finish(const EventTraceHeader &header, bool compress);
+
+ private:
+    std::string _events;
+    int64_t _lastTickCount = 0;
+    Pointi _lastMousePos;
+};
+
+/**
+ * Streaming reader for the binary trace format. Header is parsed in the constructor, events are parsed on demand.
+ * Compressed payloads are also inflated on demand, in small chunks, so the whole payload is never held in memory.
+ */
+class EventTraceReader {
+ public:
+    /**
+     * @param blob                      Serialized binary trace. The reader holds a shared copy of it.
+     * @param window                    Window to set for the window events.
+     * @throw Exception                 If the blob is not a valid binary trace.
+     */
+    EventTraceReader(const Blob &blob, PlatformWindow *window);
+    ~EventTraceReader();
+
+    /**
+     * @param blob                      Blob to check.
+     * @return                          Whether the provided blob looks like a binary trace.
+     */
+    [[nodiscard]] static bool isBinaryTrace(const Blob &blob);
+
+    [[nodiscard]] const EventTraceHeader &header() const {
+        return _header;
+    }
+
+    /**
+     * @return                          Whether the payload of the trace was zlib-compressed.
+     */
+    [[nodiscard]] bool isCompressed() const {
+        return _compressed;
+    }
+
+    /**
+     * @return                          Next event in the trace, or `nullptr` if there are no more events.
+     * @throw Exception                 On malformed data.
+     */
+    [[nodiscard]] std::unique_ptr<PlatformEvent> read();
+
+ private:
+    std::string _displayPath;
+    std::unique_ptr<InputStream> _blobStream;
+    std::unique_ptr<InputStream> _zlibStream;
+    std::unique_ptr<trace_binary::detail::BinaryReader> _reader;
+    bool _finished = false;
+    bool _compressed = false;
+    EventTraceHeader _header;
+    PlatformWindow *_window = nullptr;
+    int64_t _lastTickCount = 0;
+    Pointi _lastMousePos;
+};
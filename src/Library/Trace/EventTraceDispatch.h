@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Library/Platform/Interface/PlatformEvents.h"
+
+#include "PaintEvent.h"
+
+/**
+ * Calls the provided callable with a `nullptr` of the event class that corresponds to the provided event type. Does
+ * nothing for event types that are not traceable.
+ *
+ * @param type                          Event type.
+ * @param callable                      Callable to invoke.
+ */
+template<class Callable>
+inline void dispatchByEventType(PlatformEventType type, Callable &&callable) {
+    switch (type) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE:
+        callable(static_cast<PlatformKeyEvent *>(nullptr));
+        break;
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE:
+        callable(static_cast<PlatformMouseEvent *>(nullptr));
+        break;
+    case EVENT_MOUSE_WHEEL:
+        callable(static_cast<PlatformWheelEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_MOVE:
+        callable(static_cast<PlatformMoveEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_RESIZE:
+        callable(static_cast<PlatformResizeEvent *>(nullptr));
+        break;
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        callable(static_cast<PlatformWindowEvent *>(nullptr));
+        break;
+    case EVENT_PAINT:
+        callable(static_cast<PaintEvent *>(nullptr));
+        break;
+    default:
+        return; // No gamepad events.
+    }
+}
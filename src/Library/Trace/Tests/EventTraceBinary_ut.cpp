@@ -0,0 +1,140 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Trace/EventTrace.h"
+#include "Library/Trace/EventTraceBinary.h"
+#include "Library/Trace/PaintEvent.h"
+
+#include "Utility/Exception.h"
+
+static EventTrace makeTestTrace() {
+    EventTrace result;
+    result.header.saveFileSize = 123456;
+    result.header.config = ConfigPatch::fromEntries({{"debug", "verbose_logging", "true"}});
+    result.header.startState.locationName = "out01.odm";
+    result.header.startState.partyPosition = Vec3i(-1000, 2000, 96);
+    result.header.startState.characters.resize(2);
+    result.header.startState.characters[0].hp = 100;
+    result.header.startState.characters[0].equipment = {"Sword", "Leather Armor"};
+    result.header.endState = result.header.startState;
+    result.header.endState.characters[1].mp = -5;
+    result.header.afterLoadRandomState = -42;
+
+    int64_t tickCount = 0;
+    auto addPaint = [&] (int randomState) {
+        std::unique_ptr<PaintEvent> event = std::make_unique<PaintEvent>();
+        event->type = EVENT_PAINT;
+        event->tickCount = (tickCount += 15);
+        event->randomState = randomState;
+        result.events.push_back(std::move(event));
+    };
+
+    addPaint(1);
+
+    std::unique_ptr<PlatformKeyEvent> key = std::make_unique<PlatformKeyEvent>();
+    key->type = EVENT_KEY_PRESS;
+    key->key = PlatformKey::KEY_A;
+    key->mods = MOD_SHIFT;
+    key->isAutoRepeat = true;
+    result.events.push_back(std::move(key));
+
+    addPaint(0x7FFFFFFF);
+
+    std::unique_ptr<PlatformMouseEvent> mouse = std::make_unique<PlatformMouseEvent>();
+    mouse->type = EVENT_MOUSE_BUTTON_PRESS;
+    mouse->button = BUTTON_LEFT;
+    mouse->buttons = BUTTON_LEFT;
+    mouse->pos = Pointi(320, 240);
+    mouse->isDoubleClick = true;
+    result.events.push_back(std::move(mouse));
+
+    mouse = std::make_unique<PlatformMouseEvent>();
+    mouse->type = EVENT_MOUSE_MOVE;
+    mouse->button = BUTTON_NONE;
+    mouse->pos = Pointi(10, 470);
+    result.events.push_back(std::move(mouse));
+
+    std::unique_ptr<PlatformWheelEvent> wheel = std::make_unique<PlatformWheelEvent>();
+    wheel->type = EVENT_MOUSE_WHEEL;
+    wheel->angleDelta = Pointi(0, -120);
+    result.events.push_back(std::move(wheel));
+
+    std::unique_ptr<PlatformResizeEvent> resize = std::make_unique<PlatformResizeEvent>();
+    resize->type = EVENT_WINDOW_RESIZE;
+    resize->size = Sizei(640, 480);
+    result.events.push_back(std::move(resize));
+
+    std::unique_ptr<PlatformWindowEvent> activate = std::make_unique<PlatformWindowEvent>();
+    activate->type = EVENT_WINDOW_ACTIVATE;
+    result.events.push_back(std::move(activate));
+
+    addPaint(-1);
+    return result;
+}
+
+UNIT_TEST(EventTraceBinary, RoundTrip) {
+    EventTrace trace = makeTestTrace();
+    Blob json = EventTrace::toJsonBlob(trace);
+
+    for (bool compress : {false, true}) {
+        Blob binary = EventTrace::toBinaryBlob(trace, compress);
+        EXPECT_TRUE(EventTraceReader::isBinaryTrace(binary));
+        EXPECT_EQ(EventTraceReader(binary, nullptr).isCompressed(), compress);
+        EXPECT_LT(binary.size(), json.size());
+
+        EventTrace restored = EventTrace::fromBlob(binary, nullptr);
+        EXPECT_EQ(restored.events.size(), trace.events.size());
+        EXPECT_EQ(EventTrace::toJsonBlob(restored).string_view(), json.string_view());
+    }
+}
+
+UNIT_TEST(EventTraceBinary, Streaming) {
+    EventTrace trace = makeTestTrace();
+    EventTraceReader reader(EventTrace::toBinaryBlob(trace, true), nullptr);
+    EXPECT_EQ(reader.header().saveFileSize, trace.header.saveFileSize);
+
+    size_t count = 0;
+    while (std::unique_ptr<PlatformEvent> event = reader.read()) {
+        EXPECT_EQ(event->type, trace.events[count]->type);
+        count++;
+    }
+    EXPECT_EQ(count, trace.events.size());
+    EXPECT_EQ(reader.read(), nullptr); // Reading past the end is OK.
+}
+
+UNIT_TEST(EventTraceBinary, FromJson) {
+    Blob json = EventTrace::toJsonBlob(makeTestTrace());
+    EXPECT_FALSE(EventTraceReader::isBinaryTrace(json));
+    EXPECT_EQ(EventTrace::toJsonBlob(EventTrace::fromBlob(json, nullptr)).string_view(), json.string_view());
+}
+
+UNIT_TEST(EventTraceBinary, Truncated) {
+    Blob binary = EventTrace::toBinaryBlob(makeTestTrace(), false);
+    EXPECT_ANY_THROW((void) EventTrace::fromBinaryBlob(binary.subBlob(0, binary.size() - 1), nullptr));
+}
+
+UNIT_TEST(EventTraceBinary, HugeCounts) {
+    // Counts that don't fit into the remaining payload should throw, and not try to allocate.
+    auto makeTrace = [](std::string_view payload, uint8_t flags = 0) {
+        std::string result(trace_binary::MAGIC);
+        result += std::string("\x01\x00\x00\x00", 4); // Version.
+        result.push_back(flags);
+        result += payload;
+        return Blob::fromString(std::move(result));
+    };
+    std::string huge = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x7F"; // 2^56 - 1.
+    std::string zeros(16, '\x00');
+    std::string state = zeros.substr(0, 4); // Empty location name & party position.
+
+    EXPECT_THROW(EventTraceReader(makeTrace(zeros.substr(0, 1) + huge), nullptr), Exception); // Config entries.
+    EXPECT_THROW(EventTraceReader(makeTrace(zeros.substr(0, 2) + huge), nullptr), Exception); // Location name.
+    EXPECT_THROW(EventTraceReader(makeTrace(zeros.substr(0, 2) + state + huge), nullptr), Exception); // Characters.
+    EXPECT_THROW(EventTraceReader(makeTrace(zeros.substr(0, 2) + state + "\x01" + zeros.substr(0, 9) + huge), nullptr),
+                 Exception); // Equipment.
+
+    // Uncompressed size that deflate can't produce from an empty payload.
+    EXPECT_THROW(EventTraceReader(makeTrace(huge, trace_binary::FLAG_COMPRESSED), nullptr), Exception);
+}
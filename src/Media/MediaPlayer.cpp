@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <vector>
 #include <thread>
@@ -37,6 +39,7 @@ extern "C" {
 #include "Media/FFmpegBlobInputStream.h"
 
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/ScopeGuard.h"
 
 #include "GUI/GUIWindow.h"
 
@@ -305,8 +308,6 @@ class Movie : public IMovie {
         format_ctx = nullptr;
         playback_time = 0.0;
 
-        last_resampled_frame_num = -1;
-
         audio_data_in_device = nullptr;
         format_ctx = nullptr;
 
@@ -315,6 +316,8 @@ class Movie : public IMovie {
     }
 
     virtual ~Movie() {
+        stopDecodeThread();
+
         if (_texture != nullptr) {
             _texture->Release();
         }
@@ -401,64 +404,40 @@ class Movie : public IMovie {
         start_time = current_time;
 
         int desired_frame_number = (int)((playback_time / video.frame_len) + 0.5);
-        if (last_resampled_frame_num == desired_frame_number) {
-            return Blob::share(video.last_frame);
-        }
-        last_resampled_frame_num++;
-        if (last_resampled_frame_num == video.stream->duration) {
-            if (looping) {
-                video.reset();
-                audio.reset();
-                int err = av_seek_frame(format_ctx, -1, 0,
-                                        AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY);
-                char err_buf[2048];
-                av_strerror(err, err_buf, 2048);
-                if (err < 0) {
-                    Close();
-                    return Blob();
-                }
-                last_resampled_frame_num = 0;
-                playback_time = 0;
-                desired_frame_number = 0;
-            } else {
-                playing = false;
-                return Blob();
+
+        startDecodeThread();
+
+        std::deque<Blob> audioBuffers;
+        {
+            std::unique_lock lock(_decodeMutex);
+
+            // Nothing to show yet, wait for the decoder to catch up.
+            _decodeCondition.wait(lock, [&] { return _currentFrame || !_decodedFrames.empty() || _decodeFinished; });
+
+            bool framesTaken = false;
+            while (!_decodedFrames.empty() && (!_currentFrame || _decodedFrames.front().number <= desired_frame_number)) {
+                _currentFrame = std::move(_decodedFrames.front().pixels);
+                _currentFrameNumber = _decodedFrames.front().number;
+                _decodedFrames.pop_front();
+                framesTaken = true;
             }
-        }
+            if (framesTaken)
+                _decodeCondition.notify_all();
 
-        AVPacket *avpacket = av_packet_alloc();
+            audioBuffers.swap(_decodedAudio);
 
-        // keep reading packets until we hit the end or find a video packet
-        do {
-            if (av_read_frame(format_ctx, avpacket) < 0) {
-                // probably movie is finished
+            if (!_currentFrame || (_decodedFrames.empty() && _decodeFinished && desired_frame_number > _currentFrameNumber))
                 playing = false;
-                av_packet_free(&avpacket);
-                return Blob();
-            }
+        }
 
-            // Is this a packet from the video stream?
-            // audio packet - queue into playing
-            if (avpacket->stream_index == audio.stream_idx) {
-                Blob buffer = audio.decode_frame(avpacket);
-                if (buffer) {
-                    provider->Stream16(audio_data_in_device,
-                                       buffer.size() / 2,
-                                       buffer.data());
-                }
-            } else if (avpacket->stream_index == video.stream_idx) {
-              // Decode video frame
-              // video packet - decode & maybe show
-              video.decode_frame(avpacket);
-            } else {
-                assert(false);  // unknown stream
-            }
-        } while (avpacket->stream_index != video.stream_idx ||
-                 avpacket->pts <= desired_frame_number);
+        // Audio is queued as soon as it's decoded, OpenAL will play it in order.
+        for (const Blob &buffer : audioBuffers)
+            provider->Stream16(audio_data_in_device, buffer.size() / 2, buffer.data());
 
-        av_packet_free(&avpacket);
+        if (!playing)
+            return Blob();
 
-        return Blob::share(video.last_frame);
+        return Blob::share(_currentFrame);
     }
 
     virtual void PlayBink() override {
@@ -679,6 +658,97 @@ class Movie : public IMovie {
     }
 
  protected:
+    struct DecodedFrame {
+        int number = 0;
+        Blob pixels;
+    };
+
+    /**
+     * Starts the decoder thread if it's not running yet. Decoder thread reads the packets, decodes both the audio and
+     * the video, and converts the video frames to BGRA, running up to `MAX_DECODED_FRAMES` frames ahead of the
+     * presentation.
+     *
+     * Once the decoder thread is started, FFmpeg contexts are owned by it and should not be touched from the main
+     * thread. This is why Bink movies, which are played through `PlayBink` & `renderFrame`, don't use it.
+     */
+    void startDecodeThread() {
+        if (_decodeThread.joinable())
+            return;
+
+        assert(GetFormat() != "bink");
+        _decodeThread = std::thread([this, loop = looping] { decodeLoop(loop); });
+    }
+
+    void stopDecodeThread() {
+        if (!_decodeThread.joinable())
+            return;
+
+        {
+            std::lock_guard lock(_decodeMutex);
+            _decodeStopRequested = true;
+        }
+        _decodeCondition.notify_all();
+        _decodeThread.join();
+    }
+
+    void decodeLoop(bool loop) {
+        AVPacket *packet = av_packet_alloc();
+        MM_AT_SCOPE_EXIT(av_packet_free(&packet));
+
+        int frameNumber = 0;
+        while (true) {
+            {
+                std::unique_lock lock(_decodeMutex);
+                _decodeCondition.wait(lock, [&] { return _decodeStopRequested || _decodedFrames.size() < MAX_DECODED_FRAMES; });
+                if (_decodeStopRequested)
+                    break;
+            }
+
+            if (av_read_frame(format_ctx, packet) < 0) {
+                // End of the movie.
+                if (!loop)
+                    break;
+
+                video.reset();
+                audio.reset();
+                if (av_seek_frame(format_ctx, -1, 0, AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY) < 0)
+                    break;
+                continue;
+            }
+
+            if (packet->stream_index == audio.stream_idx) {
+                std::vector<Blob> buffers;
+                if (Blob buffer = audio.decode_frame(packet))
+                    buffers.push_back(std::move(buffer));
+                for (; !audio.queue.empty(); audio.queue.pop())
+                    buffers.push_back(std::move(audio.queue.front()));
+
+                std::lock_guard lock(_decodeMutex);
+                for (Blob &buffer : buffers)
+                    _decodedAudio.push_back(std::move(buffer));
+            } else if (packet->stream_index == video.stream_idx) {
+                std::vector<Blob> frames;
+                if (Blob frame = video.decode_frame(packet))
+                    frames.push_back(std::move(frame));
+                for (; !video.queue.empty(); video.queue.pop())
+                    frames.push_back(std::move(video.queue.front()));
+
+                std::lock_guard lock(_decodeMutex);
+                for (Blob &frame : frames)
+                    _decodedFrames.push_back({frameNumber++, std::move(frame)});
+                _decodeCondition.notify_all();
+            } else {
+                assert(false);  // unknown stream
+            }
+
+            av_packet_unref(packet);
+        }
+
+        std::lock_guard lock(_decodeMutex);
+        _decodeFinished = true;
+        _decodeCondition.notify_all();
+    }
+
     void _renderTexture(const Blob &buffer) {
         // update pixels from buffer
         _texture->rgba() = RgbaImage::copy(_texture->width(), _texture->height(), static_cast<const Color *>(buffer.data()));
@@ -698,7 +768,6 @@ class Movie : public IMovie {
     OpenALSoundProvider::StreamingTrackBuffer *audio_data_in_device;
 
     AVVideoStream video;
-    int last_resampled_frame_num;
 
     std::chrono::time_point<std::chrono::system_clock> start_time;
     bool looping;
@@ -716,6 +785,20 @@ class Movie : public IMovie {
     int _desiredFrameNumber;
     std::chrono::system_clock::time_point _currentTime;
     int _audioUpdateRate;
+
+    // Decoder thread state, see `startDecodeThread`. Everything except for the thread itself is guarded by the mutex.
+    static constexpr size_t MAX_DECODED_FRAMES = 8;
+    std::thread _decodeThread;
+    std::mutex _decodeMutex;
+    std::condition_variable _decodeCondition;
+    std::deque<DecodedFrame> _decodedFrames;
+    std::deque<Blob> _decodedAudio;
+    bool _decodeStopRequested = false;
+    bool _decodeFinished = false;
+
+    // Frame that's currently presented, only accessed from the main thread.
+    Blob _currentFrame;
+    int _currentFrameNumber = -1;
 };
 
 void MPlayer::Initialize() {
@@ -128,6 +128,7 @@ void GameBindings::_registerPartyBindings(sol::state_view &solState, sol::table
                         character->mana = val.second.as<int>();
                     } else if (key == "class") {
                         character->classType = val.second.as<Class>();
+                        character->invalidateStatCache();
                     } else if (key == "condition") {
                         character->SetCondition(val.second.as<Condition>(), false);
                     } else if (key == "skill") {
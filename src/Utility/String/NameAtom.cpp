@@ -0,0 +1,83 @@
+#include "NameAtom.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Ascii.h"
+
+namespace {
+
+struct NoCaseHash {
+    size_t operator()(std::string_view s) const {
+        // FNV-1a over lowercase chars, this way we don't need to allocate a lowercase string to look up a name.
+        size_t result = 14695981039346656037ull;
+        for (char c : s) {
+            result ^= static_cast<unsigned char>(ascii::toLower(c));
+            result *= 1099511628211ull;
+        }
+        return result;
+    }
+};
+
+struct NoCaseEquals {
+    bool operator()(std::string_view l, std::string_view r) const {
+        return ascii::noCaseEquals(l, r);
+    }
+};
+
+class AtomTable {
+ public:
+    AtomTable() {
+        insert(""); // Empty atom always has id 0.
+    }
+
+    int find(std::string_view name) {
+        {
+            std::shared_lock lock(_mutex);
+            auto pos = _idByName.find(name);
+            if (pos != _idByName.end())
+                return pos->second;
+        }
+
+        std::unique_lock lock(_mutex);
+        return insert(name); // Another thread might have inserted the name in the meantime, insert() handles that.
+    }
+
+    std::string_view name(int id) {
+        std::shared_lock lock(_mutex);
+        return _names[id];
+    }
+
+ private:
+    int insert(std::string_view name) {
+        auto pos = _idByName.find(name);
+        if (pos != _idByName.end())
+            return pos->second;
+
+        int id = _names.size();
+        const std::string &storedName = _names.emplace_back(ascii::toLower(name));
+        _idByName.emplace(storedName, id);
+        return id;
+    }
+
+ private:
+    std::shared_mutex _mutex;
+    std::deque<std::string> _names; // Deque so that string_views into it stay valid.
+    std::unordered_map<std::string_view, int, NoCaseHash, NoCaseEquals> _idByName;
+};
+
+} // namespace
+
+static AtomTable &atomTable() {
+    static AtomTable table;
+    return table;
+}
+
+NameAtom::NameAtom(std::string_view name) : _id(atomTable().find(name)) {}
+
+std::string_view NameAtom::str() const {
+    return atomTable().name(_id);
+}
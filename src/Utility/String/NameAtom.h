@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <functional> // For std::hash.
+#include <string_view>
+
+/**
+ * Interned case-insensitive name, e.g. a sprite, texture, decoration or icon name.
+ *
+ * Names are case-folded to lowercase & stored in a global table on first use, and atoms are just indices into that
+ * table. This makes atom comparisons & hashing O(1), so tables that are looked up by name can be keyed by atoms
+ * instead of strings. The intended usage is to resolve the name into an atom once, and then use the atom for lookups.
+ *
+ * Constructing an atom from a name that was already interned doesn't allocate.
+ *
+ * The atom table is global and is never cleared. It is thread-safe, so atoms can be created from worker threads, e.g.
+ * when the tables are deserialized during startup. Lookups of already interned names only take a shared lock.
+ */
+class NameAtom {
+ public:
+    /**
+     * Creates an empty atom, which is equal to `NameAtom("")`.
+     */
+    NameAtom() = default;
+
+    /**
+     * @param name                      Name to intern. Case doesn't matter.
+     */
+    explicit NameAtom(std::string_view name);
+
+    /**
+     * @return                          Lowercase name for this atom. The returned view is valid for the lifetime of
+     *                                  the program.
+     */
+    [[nodiscard]] std::string_view str() const;
+
+    /**
+     * @return                          Hash of this atom. Atom ids are unique, so this doesn't need to touch the atom
+     *                                  table.
+     */
+    [[nodiscard]] size_t hash() const {
+        return std::hash<int>()(_id);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _id == 0;
+    }
+
+    [[nodiscard]] int id() const {
+        return _id;
+    }
+
+    friend bool operator==(NameAtom l, NameAtom r) = default;
+
+ private:
+    int _id = 0;
+};
+
+template<>
+struct std::hash<NameAtom> {
+    size_t operator()(NameAtom atom) const {
+        return atom.hash();
+    }
+};
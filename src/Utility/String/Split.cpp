@@ -1,5 +1,6 @@
 #include "Split.h"
 
+#include <cstring>
 #include <string_view>
 #include <vector>
 
@@ -16,6 +17,29 @@ std::vector<char *> tokenize(char *input, const char separator) {
     return retVect;
 }
 
+char *threadSafeStrtok(char *input, const char *separators) {
+    thread_local char *state = nullptr;
+    if (input)
+        state = input;
+    if (!state)
+        return nullptr;
+
+    state += strspn(state, separators);
+    if (*state == '\0') {
+        state = nullptr;
+        return nullptr;
+    }
+
+    char *result = state;
+    state += strcspn(state, separators);
+    if (*state == '\0') {
+        state = nullptr;
+    } else {
+        *state++ = '\0';
+    }
+    return result;
+}
+
 void split(std::string_view s, char sep, std::vector<std::string_view> *result) {
     result->clear();
     result->reserve(16);
@@ -129,6 +129,16 @@ inline constexpr bool std::ranges::enable_borrowed_range<detail::SplitView> = tr
 // TODO(captainurist): drop!
 std::vector<char*> tokenize(char *input, const char separator);
 
+/**
+ * Drop-in replacement for `strtok` that can be used from several threads at once. Tokenizer state is kept in a
+ * thread-local variable, while `strtok` on POSIX platforms uses a single global one.
+ *
+ * @param input                         String to tokenize, or `nullptr` to continue tokenizing the previous string.
+ * @param separators                    Separator characters.
+ * @return                              Next token, or `nullptr` if there are no more tokens.
+ */
+char *threadSafeStrtok(char *input, const char *separators);
+
 /**
  * Splits the provided string `s` using separator `sep`, returning a range of `std::string_view` chunks.
  *
@@ -0,0 +1,70 @@
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/String/NameAtom.h"
+
+UNIT_TEST(NameAtom, Empty) {
+    EXPECT_TRUE(NameAtom().empty());
+    EXPECT_TRUE(NameAtom("").empty());
+    EXPECT_EQ(NameAtom(), NameAtom(""));
+    EXPECT_EQ(NameAtom().str(), "");
+    EXPECT_FALSE(NameAtom("a").empty());
+}
+
+UNIT_TEST(NameAtom, CaseInsensitive) {
+    NameAtom a("SpEll84");
+    NameAtom b("spell84");
+    NameAtom c("SPELL84");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(b, c);
+    EXPECT_EQ(a.id(), c.id());
+    EXPECT_EQ(a.hash(), c.hash());
+    EXPECT_EQ(a.str(), "spell84");
+    EXPECT_NE(a, NameAtom("spell85"));
+}
+
+UNIT_TEST(NameAtom, StableStorage) {
+    NameAtom first("name_atom_test_0");
+    std::string_view firstName = first.str();
+
+    // Intern enough names to force the table to grow.
+    for (int i = 1; i < 1000; i++)
+        NameAtom(std::to_string(i) + "_name_atom_test");
+
+    EXPECT_EQ(firstName.data(), NameAtom("NAME_ATOM_TEST_0").str().data());
+    EXPECT_EQ(firstName, "name_atom_test_0");
+}
+
+UNIT_TEST(NameAtom, HashMapKey) {
+    std::unordered_map<NameAtom, int> map;
+    map[NameAtom("Torch")] = 1;
+    map[NameAtom("wizeye")] = 2;
+    EXPECT_EQ(map[NameAtom("TORCH")], 1);
+    EXPECT_EQ(map[NameAtom("WizEye")], 2);
+    EXPECT_FALSE(map.contains(NameAtom("torchA")));
+}
+
+UNIT_TEST(NameAtom, Threads) {
+    // Tables are deserialized on worker threads during startup, and all of them intern names.
+    std::vector<std::vector<NameAtom>> atoms(8);
+    std::vector<std::thread> threads;
+    for (std::vector<NameAtom> &threadAtoms : atoms) {
+        threads.emplace_back([&threadAtoms] {
+            for (int i = 0; i < 1000; i++)
+                threadAtoms.push_back(NameAtom("name_atom_thread_test_" + std::to_string(i)));
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::vector<NameAtom> &threadAtoms : atoms) {
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_EQ(threadAtoms[i], atoms[0][i]);
+            EXPECT_EQ(threadAtoms[i].str(), "name_atom_thread_test_" + std::to_string(i));
+        }
+    }
+}
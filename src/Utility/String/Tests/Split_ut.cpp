@@ -110,3 +110,16 @@ UNIT_TEST(StringSplit, BorrowedRange) {
     EXPECT_EQ(*mismatch.in1, "c");
     EXPECT_EQ(*mismatch.in2, "z");
 }
+
+UNIT_TEST(StringSplit, ThreadSafeStrtok) {
+    char data[] = "\r\ra\tb\r\rc\r";
+    EXPECT_STREQ(threadSafeStrtok(data, "\r"), "a\tb");
+    EXPECT_STREQ(threadSafeStrtok(nullptr, "\r"), "c");
+    EXPECT_EQ(threadSafeStrtok(nullptr, "\r"), nullptr);
+    EXPECT_EQ(threadSafeStrtok(nullptr, "\r"), nullptr);
+
+    char other[] = "x,y";
+    EXPECT_STREQ(threadSafeStrtok(other, ","), "x");
+    EXPECT_STREQ(threadSafeStrtok(nullptr, ","), "y");
+    EXPECT_EQ(threadSafeStrtok(nullptr, ","), nullptr);
+}
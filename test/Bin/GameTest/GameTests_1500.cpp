@@ -21,11 +21,14 @@
 #include "GUI/UI/UIPartyCreation.h"
 #include "GUI/UI/UIStatusBar.h"
 #include "Engine/Graphics/BspRenderer.h"
+#include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Evt/EvtInterpreter.h"
 #include "Engine/Objects/Chest.h"
 #include "Engine/Snapshots/EntitySnapshots.h"
 
+#include "Utility/ScopeGuard.h"
+
 // 1500
 
 GAME_TEST(Issues, Issue1503) {
@@ -970,3 +973,18 @@ GAME_TEST(Issues, Issue1997) {
     EXPECT_EQ(blessTape.front(), 0);
     EXPECT_GT(blessTape.back(), 0); // Bless was cast at least once.
 }
+
+GAME_TEST(Issues, Issue1997DrawInterval) {
+    // Same trace as above, but only every 4th frame is drawn. Indoor AI depends on the party sector, which used to be
+    // updated only when drawing, so this checks that skipping draws doesn't change the end state.
+    engine->drawInterval = 4;
+    MM_AT_SCOPE_EXIT(engine->drawInterval = 1);
+
+    auto blessTape = actorTapes.countByBuff(ACTOR_BUFF_BLESS);
+    auto sectorTape = tapes.custom([] { return pBLVRenderParams->uPartyEyeSectorID; });
+    test.playTraceFromTestData("issue_1997.mm7", "issue_1997.json"); // Checks end state against the recorded one.
+    EXPECT_EQ(blessTape.front(), 0);
+    EXPECT_GT(blessTape.back(), 0);
+    EXPECT_NE(sectorTape.back(), 0);
+    EXPECT_EQ(sectorTape.back(), pIndoor->GetSector(pParty->pos + Vec3f(0, 0, pParty->eyeLevel)));
+}